@@ -136,6 +136,14 @@
   #define FLATBUFFERS_DELETE_FUNC(func) private: func;
 #endif
 
+// Hint to the CPU that `addr` will be read soon. Never faults, so it may be
+// given addresses past the end of the data.
+#if defined(__GNUC__) || defined(__clang__)
+  #define FLATBUFFERS_PREFETCH(addr) __builtin_prefetch(addr)
+#else
+  #define FLATBUFFERS_PREFETCH(addr)
+#endif
+
 #if defined(_MSC_VER)
   #pragma warning(push)
   #pragma warning(disable: 4127) // C4127: conditional expression is constant
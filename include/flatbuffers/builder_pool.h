@@ -0,0 +1,261 @@
+/*
+ * Copyright 2017 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_BUILDER_POOL_H_
+#define FLATBUFFERS_BUILDER_POOL_H_
+
+#include <atomic>
+#include <memory>
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace flatbuffers {
+
+// A pool of FlatBufferBuilders, for code that builds many short-lived
+// buffers (e.g. one per RPC response). Builders handed out by the pool keep
+// their buffer, scratch vectors and string pool from previous uses, so a
+// warmed up builder doesn't allocate at all.
+//
+// Each thread caches the last builder it returned, so a thread that keeps
+// acquiring and returning builders never touches shared state. Beyond that,
+// builders are kept in a fixed number of lock-free shared slots.
+// Builders whose buffer grew beyond `max_retained_size` get their memory
+// released when returned, so one huge message doesn't pin memory forever.
+//
+// Usage:
+//   BuilderPool pool;
+//   auto fbb = pool.Acquire();
+//   fbb->Finish(CreateMonster(*fbb, ...));
+//   send(fbb->GetBufferPointer(), fbb->GetSize());
+//   // The builder goes back to the pool when `fbb` goes out of scope.
+class BuilderPool {
+ private:
+  class PooledBuilder;
+  struct Shared;
+
+ public:
+  // RAII handle to a builder from the pool, returns it to the pool when
+  // destroyed.
+  class Lease {
+   public:
+    Lease(Lease &&other) : shared_(std::move(other.shared_)),
+                           builder_(other.builder_) {
+      other.builder_ = nullptr;
+    }
+
+    Lease &operator=(Lease &&other) {
+      Return();
+      shared_ = std::move(other.shared_);
+      builder_ = other.builder_;
+      other.builder_ = nullptr;
+      return *this;
+    }
+
+    ~Lease() { Return(); }
+
+    FlatBufferBuilder *get() const { return builder_; }
+    FlatBufferBuilder *operator->() const { return builder_; }
+    FlatBufferBuilder &operator*() const { return *builder_; }
+
+    // Takes the finished buffer out of the builder, and returns the builder
+    // to the pool. The buffer's memory is not retained by the pool.
+    DetachedBuffer Release() {
+      auto buf = builder_->Release();
+      Return();
+      return buf;
+    }
+
+    // These may change access mode, leave these at end of public section
+    FLATBUFFERS_DELETE_FUNC(Lease(const Lease &other))
+    FLATBUFFERS_DELETE_FUNC(Lease &operator=(const Lease &other))
+
+   private:
+    friend class BuilderPool;
+
+    Lease(const std::shared_ptr<Shared> &shared, PooledBuilder *builder)
+      : shared_(shared), builder_(builder) {}
+
+    void Return() {
+      if (builder_) BuilderPool::Return(shared_, builder_);
+      builder_ = nullptr;
+    }
+
+    std::shared_ptr<Shared> shared_;
+    PooledBuilder *builder_;
+  };
+
+  // `max_retained_size` is the largest buffer (in bytes) a builder may keep
+  // when returned to the pool. `max_pooled` is the number of builders kept
+  // in the shared slots, on top of the one cached per thread.
+  // `initial_size` and `allocator` are passed on to new builders, the
+  // allocator is not owned, and must outlive the pool and all threads that
+  // used it (since they may still have a builder cached).
+  explicit BuilderPool(size_t max_retained_size = 1024 * 1024,
+                       size_t max_pooled = 16,
+                       size_t initial_size = 1024,
+                       Allocator *allocator = nullptr)
+    : shared_(std::make_shared<Shared>(max_retained_size, max_pooled,
+                                       initial_size, allocator)) {}
+
+  // Frees all pooled builders, except those cached by other threads, which
+  // are freed when those threads next return a builder to a pool, or exit.
+  ~BuilderPool() {
+    shared_->closed = true;
+    auto &cache = GetThreadCache();
+    if (cache.shared == shared_) {
+      delete cache.builder;
+      cache.builder = nullptr;
+      cache.shared.reset();
+    }
+    while (auto builder = shared_->Take()) delete builder;
+  }
+
+  // Get a builder, ready to use.
+  Lease Acquire() {
+    auto &cache = GetThreadCache();
+    PooledBuilder *builder = nullptr;
+    if (cache.builder && cache.shared == shared_) {
+      builder = cache.builder;
+      cache.builder = nullptr;
+    } else {
+      builder = shared_->Take();
+    }
+    if (!builder) {
+      builder = new PooledBuilder(shared_->initial_size, shared_->allocator);
+    }
+    return Lease(shared_, builder);
+  }
+
+ private:
+  class PooledBuilder : public FlatBufferBuilder {
+   public:
+    PooledBuilder(size_t initial_size, Allocator *allocator)
+      : FlatBufferBuilder(initial_size, allocator) {}
+
+    // Get ready for the next user, dropping memory beyond `max_size`, and
+    // restoring the default settings.
+    void Recycle(size_t max_size) {
+      Clear();
+      ForceDefaults(false);
+      DedupVtables(true);
+      DedupTables(false);
+      if (buf_.is_fixed()) buf_.reset();  // Forget UseFixedBuffer().
+      UseSegments(0);
+      if (buf_.capacity() > max_size) buf_.reset();
+      if (offsetbuf_.capacity() * sizeof(FieldLoc) > max_size) {
+        std::vector<FieldLoc>().swap(offsetbuf_);
+      }
+      if (vtables_.capacity() * sizeof(uoffset_t) > max_size) {
+        std::vector<uoffset_t>().swap(vtables_);
+        vtable_index_ = OffsetHashIndex();
+      }
+      if (string_pool.capacity() * sizeof(uoffset_t) > max_size) {
+        string_pool = OffsetHashIndex();
+      }
+      if (table_pool_.capacity() * sizeof(uoffset_t) > max_size) {
+        table_pool_ = OffsetHashIndex();
+      }
+      if (vector_pool_.capacity() * sizeof(uoffset_t) > max_size) {
+        vector_pool_ = OffsetHashIndex();
+      }
+    }
+  };
+
+  struct Shared {
+    Shared(size_t _max_retained_size, size_t _max_pooled, size_t _initial_size,
+           Allocator *_allocator)
+      : max_retained_size(_max_retained_size), initial_size(_initial_size),
+        allocator(_allocator), closed(false), slots(_max_pooled) {
+      for (auto it = slots.begin(); it != slots.end(); ++it) *it = nullptr;
+    }
+
+    ~Shared() {
+      for (auto it = slots.begin(); it != slots.end(); ++it) delete it->load();
+    }
+
+    PooledBuilder *Take() {
+      for (auto it = slots.begin(); it != slots.end(); ++it) {
+        if (it->load(std::memory_order_relaxed)) {
+          auto builder = it->exchange(nullptr, std::memory_order_acquire);
+          if (builder) return builder;
+        }
+      }
+      return nullptr;
+    }
+
+    void Put(PooledBuilder *builder) {
+      if (closed) {
+        delete builder;
+        return;
+      }
+      for (auto it = slots.begin(); it != slots.end(); ++it) {
+        PooledBuilder *empty = nullptr;
+        if (it->compare_exchange_strong(empty, builder,
+                                        std::memory_order_release)) {
+          return;
+        }
+      }
+      delete builder;  // Pool is full.
+    }
+
+    size_t max_retained_size;
+    size_t initial_size;
+    Allocator *allocator;
+    std::atomic<bool> closed;  // Set when the BuilderPool is destroyed.
+    std::vector<std::atomic<PooledBuilder *>> slots;
+  };
+
+  // Per thread, a single builder is cached for the pool it was last returned
+  // to. It goes back to that pool when the thread exits.
+  struct ThreadCache {
+    ThreadCache() : builder(nullptr) {}
+    ~ThreadCache() { if (builder) shared->Put(builder); }
+
+    std::shared_ptr<Shared> shared;
+    PooledBuilder *builder;
+  };
+
+  static ThreadCache &GetThreadCache() {
+    static thread_local ThreadCache cache;
+    return cache;
+  }
+
+  static void Return(const std::shared_ptr<Shared> &shared,
+                     PooledBuilder *builder) {
+    builder->Recycle(shared->max_retained_size);
+    auto &cache = GetThreadCache();
+    if (shared->closed) {
+      delete builder;
+      return;
+    }
+    if (cache.builder) {
+      // Keep the builder we have cached, if it is for the same pool.
+      if (cache.shared == shared) {
+        shared->Put(builder);
+        return;
+      }
+      cache.shared->Put(cache.builder);
+    }
+    cache.shared = shared;
+    cache.builder = builder;
+  }
+
+  std::shared_ptr<Shared> shared_;
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_BUILDER_POOL_H_
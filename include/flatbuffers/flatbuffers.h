@@ -19,6 +19,20 @@
 
 #include "flatbuffers/base.h"
 
+#include <atomic>
+
+#ifdef FLATBUFFERS_VERIFIER_STATS
+  #include <chrono>
+#endif
+
+// The Verifier checks vectors of strings with AVX2 on CPUs that have it.
+// Define FLATBUFFERS_NO_SIMD to always use the portable code.
+#if !defined(FLATBUFFERS_NO_SIMD) && defined(__x86_64__) && \
+    (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5))
+  #define FLATBUFFERS_VERIFIER_AVX2
+  #include <immintrin.h>
+#endif
+
 namespace flatbuffers {
 // Wrapper for uoffset_t to allow safe template specialization.
 // Value is allowed to be 0 to indicate a null object (see e.g. AddOffset).
@@ -177,6 +191,34 @@ private:
 
 struct String;
 
+// A vector in Eytzinger order stores a sorted sequence as an implicit binary
+// search tree in breadth first order: the children of the element at index i
+// are at 2i+1 and 2i+2. The top levels of the tree share a few cache lines,
+// and lookups descend it without unpredictable branches.
+// These walk such a vector of `size` elements in sorted order, e.g.:
+//   for (auto i = EytzingerFirst(n); i < n; i = EytzingerNext(i, n)) ...
+inline uoffset_t EytzingerFirst(uoffset_t size) {
+  if (!size) return 0;
+  size_t j = 1;  // 1-based, so the children of j are 2j and 2j+1.
+  while (2 * j <= size) j *= 2;
+  return static_cast<uoffset_t>(j - 1);
+}
+
+// Returns `size` after the last element.
+inline uoffset_t EytzingerNext(uoffset_t index, uoffset_t size) {
+  size_t j = index + 1;
+  if (2 * j + 1 <= size) {
+    // Leftmost element of the right subtree.
+    j = 2 * j + 1;
+    while (2 * j <= size) j *= 2;
+  } else {
+    // Go up past all the right children, then up once more.
+    while (j & 1) j >>= 1;
+    j >>= 1;
+  }
+  return j ? static_cast<uoffset_t>(j - 1) : size;
+}
+
 // This is used as a helper type for accessing vectors.
 // Vector::data() assumes the vector elements start after the length field.
 template<typename T> class Vector {
@@ -279,6 +321,49 @@ public:
     return IndirectHelper<T>::Read(element, 0);
   }
 
+  // Like LookupByKey, using a hash index made by
+  // FlatBufferBuilder::CreateKeyHashIndex for this vector, for expected O(1)
+  // lookups. Falls back to binary search if there is no index.
+  template<typename K> return_type LookupByKey(
+      K key, const Vector<uint32_t> *hash_index) const {
+    if (!hash_index || !hash_index->size()) return LookupByKey(key);
+    typedef typename std::remove_pointer<return_type>::type element_type;
+    auto hash = element_type::KeyHashWithValue(key);
+    // Pairs of (hash, element index + 1), 0 marking an empty slot.
+    auto mask = hash_index->size() / 2 - 1;
+    for (uoffset_t probe = 0, slot = hash & mask; probe <= mask;
+         probe++, slot = (slot + 1) & mask) {
+      auto index = hash_index->Get(2 * slot + 1);
+      if (!index) break;
+      if (hash_index->Get(2 * slot) != hash) continue;
+      auto elem = Get(index - 1);
+      if (!elem->KeyCompareWithValue(key)) return elem;
+    }
+    return nullptr;
+  }
+
+  // Like LookupByKey, for vectors created with CreateVectorOfEytzingerTables
+  // or CreateVectorOfEytzingerStructs.
+  template<typename K> return_type LookupByKeyEytzinger(K key) const {
+    const size_t n = size();
+    size_t j = 1;  // 1-based position in the tree.
+    while (j <= n) {
+      // The 16 descendants 4 levels down are contiguous, fetch them early.
+      FLATBUFFERS_PREFETCH(Data() + (16 * j - 1) *
+                           IndirectHelper<T>::element_stride);
+      auto elem = IndirectHelper<T>::Read(Data(), j - 1);
+      j = 2 * j + (elem->KeyCompareWithValue(key) < 0);
+    }
+    // The bits of j are the path taken, 1 meaning right. The smallest element
+    // not less than the key is where we last went left: drop the trailing
+    // right turns and that left turn.
+    while (j & 1) j >>= 1;
+    j >>= 1;
+    if (!j) return nullptr;  // All elements are less than the key.
+    auto elem = IndirectHelper<T>::Read(Data(), j - 1);
+    return elem->KeyCompareWithValue(key) ? nullptr : elem;
+  }
+
 protected:
   // This class is only used to access pre-existing data. Don't ever
   // try to construct these manually.
@@ -346,12 +431,128 @@ template<typename T> static inline size_t VectorLength(const Vector<T> *v) {
 struct String : public Vector<char> {
   const char *c_str() const { return reinterpret_cast<const char *>(Data()); }
   std::string str() const { return std::string(c_str(), Length()); }
+  // Like str(), without allocating or copying.
+  flatbuffers::string_view string_view() const {
+    return flatbuffers::string_view(c_str(), Length());
+  }
 
   bool operator <(const String &o) const {
     return strcmp(c_str(), o.c_str()) < 0;
   }
 };
 
+// The elements of a vector of scalars or structs as a span, pointing into the
+// buffer, e.g. to pass them to code that takes a pointer and a size.
+// Vector<const T *> (structs) gives a span<const T>.
+// Scalars are stored little endian, so this is not available for vectors of
+// multi-byte scalars on big endian machines.
+template<typename T>
+span<const typename std::remove_pointer<T>::type> make_span(
+    const Vector<T> &vec) {
+  static_assert(std::is_pointer<T>::value ||
+                (is_scalar<T>::value &&
+                 (FLATBUFFERS_LITTLEENDIAN || sizeof(T) == 1)),
+                "make_span: elements must be structs, or scalars in their "
+                "native representation");
+  typedef typename std::remove_pointer<T>::type E;
+  return span<const E>(reinterpret_cast<const E *>(vec.Data()), vec.size());
+}
+
+// Iterates over a vector of tables or strings like Vector::begin() / end(),
+// but prefetches ahead: the object `distance` elements ahead, and (for
+// tables) the vtable of the one `distance / 2` elements ahead, since reading
+// its vtable offset needs the prefetch of the table itself to have landed.
+// This hides the cache misses of scans over large vectors whose objects are
+// scattered through the buffer. The right distance depends on how much work
+// is done per element: more work needs less distance.
+// Usage:
+//   for (auto monster : flatbuffers::Prefetching(*monsters)) ...
+template<typename T> class PrefetchingIterator {
+ public:
+  PrefetchingIterator(const uint8_t *data, uoffset_t i, uoffset_t size,
+                      uoffset_t distance)
+    : data_(data), i_(i), size_(size), distance_(distance) {}
+
+  const T *operator*() const {
+    return IndirectHelper<Offset<T>>::Read(data_, i_);
+  }
+  const T *operator->() const { return **this; }
+
+  bool operator==(const PrefetchingIterator &other) const {
+    return i_ == other.i_;
+  }
+  bool operator!=(const PrefetchingIterator &other) const {
+    return i_ != other.i_;
+  }
+
+  PrefetchingIterator &operator++() {
+    i_++;
+    auto ahead = static_cast<size_t>(i_) + distance_;
+    if (ahead < size_) {
+      FLATBUFFERS_PREFETCH(IndirectHelper<Offset<T>>::Read(data_, ahead));
+    }
+    ahead = static_cast<size_t>(i_) + distance_ / 2;
+    if (ahead < size_) {
+      PrefetchVTable(IndirectHelper<Offset<T>>::Read(data_, ahead));
+    }
+    return *this;
+  }
+
+  // Issues the prefetches operator++ would have issued for the elements up
+  // to the current one plus `distance`, so the first ones aren't missed.
+  void PrefetchFirst() const {
+    auto end = std::min(static_cast<size_t>(i_) + distance_ + 1,
+                        static_cast<size_t>(size_));
+    for (auto j = static_cast<size_t>(i_); j < end; j++) {
+      FLATBUFFERS_PREFETCH(IndirectHelper<Offset<T>>::Read(data_, j));
+    }
+    end = std::min(static_cast<size_t>(i_) + distance_ / 2 + 1, end);
+    for (auto j = static_cast<size_t>(i_); j < end; j++) {
+      PrefetchVTable(IndirectHelper<Offset<T>>::Read(data_, j));
+    }
+  }
+
+ private:
+  static void PrefetchVTable(const String *) {}
+  template<typename U> static void PrefetchVTable(const U *table) {
+    auto p = reinterpret_cast<const uint8_t *>(table);
+    FLATBUFFERS_PREFETCH(p - ReadScalar<soffset_t>(p));
+  }
+
+  const uint8_t *data_;
+  uoffset_t i_;
+  uoffset_t size_;
+  uoffset_t distance_;
+};
+
+template<typename T> class PrefetchingRange {
+ public:
+  PrefetchingRange(const Vector<Offset<T>> &vec, uoffset_t distance)
+    : vec_(vec), distance_(distance) {}
+
+  PrefetchingIterator<T> begin() const {
+    PrefetchingIterator<T> it(vec_.Data(), 0, vec_.size(), distance_);
+    it.PrefetchFirst();
+    return it;
+  }
+  PrefetchingIterator<T> end() const {
+    return PrefetchingIterator<T>(vec_.Data(), vec_.size(), vec_.size(),
+                                  distance_);
+  }
+
+ private:
+  const Vector<Offset<T>> &vec_;
+  uoffset_t distance_;
+
+  // This class holds a reference, don't copy it.
+  PrefetchingRange &operator=(const PrefetchingRange &);
+};
+
+template<typename T> PrefetchingRange<T> Prefetching(
+    const Vector<Offset<T>> &vec, uoffset_t distance = 32) {
+  return PrefetchingRange<T>(vec, distance);
+}
+
 // Allocator interface. This is flatbuffers-specific and meant only for
 // `vector_downward` usage.
 class Allocator {
@@ -394,6 +595,121 @@ class DefaultAllocator : public Allocator {
   }
 };
 
+// ArenaAllocator serves allocations from a caller supplied memory region,
+// and once that is full, from a chain of large blocks obtained from another
+// allocator. Memory is only reclaimed all at once, by Reset() or destroying
+// the arena, which makes it suitable for e.g. all the buffers built for a
+// single request. Any DetachedBuffer using it must be gone by then.
+// Memory is handed out from the top of each block downwards, so that a
+// vector_downward that grows while it is the last allocation in the arena
+// can grow in place, without copying.
+// Not thread-safe.
+class ArenaAllocator : public Allocator {
+ public:
+  explicit ArenaAllocator(size_t block_size = 64 * 1024,
+                          Allocator *upstream = nullptr)
+    : upstream_(upstream ? upstream : &DefaultAllocator::instance()),
+      block_size_(block_size), region_(nullptr), region_size_(0),
+      begin_(nullptr), cur_(nullptr) {}
+
+  // Use `region` (not owned) before allocating any blocks.
+  ArenaAllocator(uint8_t *region, size_t region_size,
+                 size_t block_size = 64 * 1024, Allocator *upstream = nullptr)
+    : upstream_(upstream ? upstream : &DefaultAllocator::instance()),
+      block_size_(block_size), region_(region), region_size_(region_size),
+      begin_(region), cur_(region + region_size) {}
+
+  ~ArenaAllocator() {
+    for (auto it = blocks_.begin(); it != blocks_.end(); ++it) {
+      upstream_->deallocate(it->first, it->second);
+    }
+  }
+
+  virtual uint8_t *allocate(size_t size) FLATBUFFERS_OVERRIDE {
+    if (!fits(size)) add_block(size);
+    cur_ = align_down(cur_ - size);
+    return cur_;
+  }
+
+  // Only the most recent allocation is actually freed, everything else
+  // is freed by Reset().
+  virtual void deallocate(uint8_t *p, size_t size) FLATBUFFERS_OVERRIDE {
+    if (p == cur_) cur_ += size;
+  }
+
+  virtual uint8_t *reallocate_downward(uint8_t *old_p, size_t old_size,
+                                       size_t new_size) FLATBUFFERS_OVERRIDE {
+    assert(new_size > old_size);  // vector_downward only grows
+    auto grow = new_size - old_size;
+    if (old_p == cur_ && static_cast<size_t>(cur_ - begin_) >= grow) {
+      // Last allocation: extend it downwards, the data stays where it is.
+      cur_ -= grow;
+      return cur_;
+    }
+    return Allocator::reallocate_downward(old_p, old_size, new_size);
+  }
+
+  // Frees all allocations at once. The caller supplied region (or else the
+  // first block) is kept for reuse.
+  void Reset() {
+    if (region_) {
+      for (auto it = blocks_.begin(); it != blocks_.end(); ++it) {
+        upstream_->deallocate(it->first, it->second);
+      }
+      blocks_.clear();
+      begin_ = region_;
+      cur_ = region_ + region_size_;
+    } else if (!blocks_.empty()) {
+      for (auto it = blocks_.begin() + 1; it != blocks_.end(); ++it) {
+        upstream_->deallocate(it->first, it->second);
+      }
+      blocks_.resize(1);
+      begin_ = blocks_.front().first;
+      cur_ = begin_ + blocks_.front().second;
+    }
+  }
+
+  // Total bytes obtained from the upstream allocator.
+  size_t GetBlockBytes() const {
+    size_t total = 0;
+    for (auto it = blocks_.begin(); it != blocks_.end(); ++it) {
+      total += it->second;
+    }
+    return total;
+  }
+
+ private:
+  FLATBUFFERS_DELETE_FUNC(ArenaAllocator(const ArenaAllocator &))
+  FLATBUFFERS_DELETE_FUNC(ArenaAllocator &operator=(const ArenaAllocator &))
+
+  static uint8_t *align_down(uint8_t *p) {
+    return reinterpret_cast<uint8_t *>(reinterpret_cast<uintptr_t>(p) &
+                                       ~(FLATBUFFERS_MAX_ALIGNMENT - 1));
+  }
+
+  bool fits(size_t size) const {
+    return cur_ && static_cast<size_t>(cur_ - begin_) >=
+                     size + FLATBUFFERS_MAX_ALIGNMENT - 1;
+  }
+
+  void add_block(size_t size) {
+    auto block_size = (std::max)(block_size_,
+                                 size + FLATBUFFERS_MAX_ALIGNMENT - 1);
+    begin_ = upstream_->allocate(block_size);
+    cur_ = begin_ + block_size;
+    blocks_.push_back(std::make_pair(begin_, block_size));
+  }
+
+  Allocator *upstream_;
+  size_t block_size_;
+  uint8_t *region_;
+  size_t region_size_;
+  // The block currently being allocated from, from the top down.
+  uint8_t *begin_;
+  uint8_t *cur_;
+  std::vector<std::pair<uint8_t *, size_t>> blocks_;
+};
+
 // DetachedBuffer is a finished flatbuffer memory region, detached from its
 // builder. The original memory region and allocator are also stored so that
 // the DetachedBuffer can manage the memory lifetime.
@@ -500,6 +816,27 @@ class DetachedBuffer {
   }
 };
 
+#ifdef FLATBUFFERS_BUILDER_STATS
+// Counters describing how a buffer was built, see
+// FlatBufferBuilder::GetStats(). Only tracked when FLATBUFFERS_BUILDER_STATS
+// is defined, so they cost nothing otherwise.
+struct BuilderStats {
+  BuilderStats()
+    : reallocations(0), bytes_copied(0), padding_bytes(0), vtables_created(0),
+      vtables_deduped(0), string_pool_hits(0), string_pool_misses(0),
+      peak_fields(0) {}
+
+  size_t reallocations;  // Times the buffer had to grow.
+  size_t bytes_copied;  // Bytes moved to make the buffer grow (or flatten).
+  size_t padding_bytes;  // Zero bytes inserted for alignment.
+  size_t vtables_created;
+  size_t vtables_deduped;
+  size_t string_pool_hits;  // CreateSharedString() found the string.
+  size_t string_pool_misses;
+  size_t peak_fields;  // Most fields tracked for a single table.
+};
+#endif
+
 // This is a minimal replication of std::vector<uint8_t> functionality,
 // except growing from higher to lower addresses. i.e push_back() inserts data
 // in the lowest address in the vector.
@@ -510,12 +847,18 @@ class vector_downward {
                            bool own_allocator = false)
     : allocator_(allocator ? allocator : &DefaultAllocator::instance()),
       own_allocator_(own_allocator), initial_size_(initial_size), reserved_(0),
-      buf_(nullptr), cur_(nullptr) {
+      buf_(nullptr), cur_(nullptr), segment_size_(0), base_(0), fixed_(false),
+      out_of_space_(false)
+    #ifdef FLATBUFFERS_BUILDER_STATS
+      , reallocations_(0), bytes_copied_(0)
+    #endif
+  {
     assert(allocator_);
   }
 
   ~vector_downward() {
-    if (buf_) {
+    free_segments();
+    if (buf_ && !fixed_) {
       assert(allocator_);
       allocator_->deallocate(buf_, reserved_);
     }
@@ -524,17 +867,35 @@ class vector_downward {
     }
   }
 
+  // Also forgets the buffer given to set_fixed_buffer(), if any.
   void reset() {
-    if (buf_) {
+    free_segments();
+    if (buf_ && !fixed_) {
       assert(allocator_);
       allocator_->deallocate(buf_, reserved_);
     }
+    fixed_ = false;
+    out_of_space_ = false;
     reserved_ = 0;
     buf_ = nullptr;
     cur_ = nullptr;
   }
 
   void clear() {
+    if (!segments_.empty()) {
+      // Keep the first segment only, since it is the one laid out for an
+      // empty buffer.
+      allocator_->deallocate(buf_, reserved_);
+      buf_ = segments_.front().buf;
+      reserved_ = segments_.front().reserved;
+      segments_.front().buf = nullptr;
+      free_segments();
+    }
+    out_of_space_ = false;
+    #ifdef FLATBUFFERS_BUILDER_STATS
+      reallocations_ = 0;
+      bytes_copied_ = 0;
+    #endif
     if (buf_) {
       cur_ = buf_ + reserved_;
     } else {
@@ -545,10 +906,18 @@ class vector_downward {
   }
 
   // Relinquish the pointer to the caller.
+  // If the allocator is not owned, it is kept, so this can be used again
+  // after clear().
+  // With a fixed buffer, the DetachedBuffer merely points into it, and this
+  // keeps using the same buffer after clear().
   DetachedBuffer release() {
+    if (fixed_) {
+      return DetachedBuffer(allocator_, false, nullptr, 0, cur_, size());
+    }
+    flatten();
     DetachedBuffer fb(allocator_, own_allocator_, buf_, reserved_, cur_,
                       size());
-    allocator_ = nullptr;
+    if (own_allocator_) allocator_ = nullptr;
     own_allocator_ = false;
     reserved_ = 0;
     buf_ = nullptr;
@@ -561,9 +930,56 @@ class vector_downward {
                         : ((bytes / 2) & ~(AlignOf<largest_scalar_t>() - 1));
   }
 
+  // Instead of reallocating and copying the whole buffer when it runs out of
+  // space, allocate a new segment of at least `segment_size` bytes and keep
+  // writing there (0 turns this off). The data is only copied into a single
+  // block when calling flatten() (or release()), until then it can be
+  // accessed as a list of segments with get_segments().
+  // Each call to make_space() still returns contiguous memory, but objects
+  // written with several calls may straddle two segments.
+  void set_segment_size(size_t segment_size) {
+    assert(!fixed_);
+    segment_size_ = segment_size;
+  }
+
+  size_t segment_size() const { return segment_size_; }
+
+  #ifdef FLATBUFFERS_BUILDER_STATS
+  // Since the last clear().
+  size_t reallocations() const { return reallocations_; }
+  size_t bytes_copied() const { return bytes_copied_; }
+  #endif
+
+  // Write into the caller supplied `buf` of `size` bytes, and never allocate
+  // or grow it. Once a write doesn't fit, out_of_space() is set, and that
+  // write (and all writes after it that don't fit either) is dropped, so
+  // callers can carry on and check for the error at the end. make_space()
+  // then returns a small scratch area for writes of a scalar or two, and
+  // nullptr for larger ones.
+  // The end of `buf` should be aligned to the largest scalar or struct that
+  // will be written. The buffer must be empty.
+  void set_fixed_buffer(uint8_t *buf, size_t size) {
+    assert(!this->size() && !segment_size_);
+    reset();
+    fixed_ = true;
+    buf_ = buf;
+    reserved_ = size;
+    cur_ = buf_ + reserved_;
+  }
+
+  bool is_fixed() const { return fixed_; }
+
+  // Whether a write didn't fit in the fixed buffer since the last clear().
+  bool out_of_space() const { return out_of_space_; }
+
+  // Flags the buffer as out of space, for when the builder runs out of some
+  // other fixed capacity.
+  void set_out_of_space() { out_of_space_ = true; }
+
   uint8_t *make_space(size_t len) {
     assert(cur_ >= buf_);
     if (len > static_cast<size_t>(cur_ - buf_)) {
+      if (fixed_) return overflow(len);
       reallocate(len);
     }
     cur_ -= len;
@@ -573,14 +989,26 @@ class vector_downward {
     return cur_;
   }
 
+  // Makes sure the next `len` bytes can be written without reallocating,
+  // and will be contiguous in memory even when using segments.
+  void ensure_space(size_t len) {
+    if (len > static_cast<size_t>(cur_ - buf_) && !fixed_) {
+      reallocate(len);
+    }
+  }
+
   Allocator &get_allocator() { return *allocator_; }
 
   uoffset_t size() const {
-    return static_cast<uoffset_t>(reserved_ - (cur_ - buf_));
+    return base_ + static_cast<uoffset_t>(reserved_ - (cur_ - buf_));
   }
 
   size_t capacity() const {
-    return reserved_;
+    auto total = reserved_;
+    for (auto it = segments_.begin(); it != segments_.end(); ++it) {
+      total += it->reserved;
+    }
+    return total;
   }
 
   uint8_t *buf() const {
@@ -593,48 +1021,139 @@ class vector_downward {
     return cur_;
   }
 
-  uint8_t *data_at(size_t offset) const { return buf_ + reserved_ - offset; }
+  uint8_t *data_at(size_t offset) const {
+    if (offset <= base_ && base_) return segment_data_at(offset);
+    return buf_ + reserved_ - (offset - base_);
+  }
+
+  // Whether all data is in a single block, i.e. data() points at the start
+  // of the whole buffer.
+  bool is_contiguous() const { return segments_.empty(); }
+
+  // Whether the buffer grows by adding segments, see set_segment_size().
+  bool is_segmented() const { return segment_size_ != 0; }
+
+  // The data as a list of memory regions, in the order they appear in the
+  // buffer (i.e. the start of the buffer comes first).
+  std::vector<std::pair<const uint8_t *, size_t>> get_segments() const {
+    std::vector<std::pair<const uint8_t *, size_t>> regions;
+    if (cur_ != buf_ + reserved_) {
+      regions.push_back(std::make_pair(cur_, size() - base_));
+    }
+    for (auto it = segments_.rbegin(); it != segments_.rend(); ++it) {
+      regions.push_back(std::make_pair(it->cur, it->used()));
+    }
+    return regions;
+  }
+
+  // Copies all segments into a single block, after which the buffer is
+  // contiguous again.
+  void flatten() {
+    if (segments_.empty()) return;
+    FLATBUFFERS_CONSTEXPR size_t alignment = AlignOf<largest_scalar_t>();
+    auto new_size = size();
+    auto new_reserved = (new_size + alignment - 1) & ~(alignment - 1);
+    auto new_buf = allocator_->allocate(new_reserved);
+    auto dest = new_buf + new_reserved - new_size;
+    auto regions = get_segments();
+    for (auto it = regions.begin(); it != regions.end(); ++it) {
+      memcpy(dest, it->first, it->second);
+      dest += it->second;
+    }
+    free_segments();
+    allocator_->deallocate(buf_, reserved_);
+    buf_ = new_buf;
+    reserved_ = new_reserved;
+    cur_ = buf_ + reserved_ - new_size;
+    #ifdef FLATBUFFERS_BUILDER_STATS
+      bytes_copied_ += new_size;
+    #endif
+  }
 
   void push(const uint8_t *bytes, size_t num) {
     auto dest = make_space(num);
-    memcpy(dest, bytes, num);
+    if (dest) memcpy(dest, bytes, num);  // See set_fixed_buffer().
   }
 
   // Specialized version of push() that avoids memcpy call for small data.
   template<typename T> void push_small(const T& little_endian_t) {
     auto dest = make_space(sizeof(T));
-    *reinterpret_cast<T *>(dest) = little_endian_t;
+    // Only structs are too big for the scratch area, see set_fixed_buffer().
+    if (sizeof(T) <= sizeof(scratch_) || dest) {
+      // A fixed size memcpy compiles to plain moves, which unlike assigning
+      // a T don't assume dest is aligned beyond what the buffer guarantees.
+      memcpy(dest, &little_endian_t, sizeof(T));
+    }
   }
 
   // fill() is most frequently called with small byte counts (<= 4),
   // which is why we're using loops rather than calling memset.
   void fill(size_t zero_pad_bytes) {
     auto dest = make_space(zero_pad_bytes);
+    if (!dest) return;  // See set_fixed_buffer().
     for (size_t i = 0; i < zero_pad_bytes; i++) dest[i] = 0;
   }
 
   // Version for when we know the size is larger.
   void fill_big(size_t zero_pad_bytes) {
     auto dest = make_space(zero_pad_bytes);
-    memset(dest, 0, zero_pad_bytes);
+    if (dest) memset(dest, 0, zero_pad_bytes);
   }
 
-  void pop(size_t bytes_to_remove) { cur_ += bytes_to_remove; }
+  void pop(size_t bytes_to_remove) {
+    // Popping past the start of the current segment drops it.
+    while (!segments_.empty() && bytes_to_remove > size() - base_) {
+      bytes_to_remove -= size() - base_;
+      pop_segment();
+    }
+    cur_ += bytes_to_remove;
+  }
 
  private:
   // You shouldn't really be copying instances of this class.
   FLATBUFFERS_DELETE_FUNC(vector_downward(const vector_downward &))
   FLATBUFFERS_DELETE_FUNC(vector_downward &operator=(const vector_downward &))
 
+  // A full segment, see set_segment_size().
+  struct Segment {
+    uint8_t *buf;
+    size_t reserved;
+    uint8_t *cur;
+    uoffset_t base;  // Size of the buffer before this segment was started.
+    uoffset_t used() const {
+      return static_cast<uoffset_t>(reserved - (cur - buf));
+    }
+  };
+
   Allocator *allocator_;
   bool own_allocator_;
   size_t initial_size_;
   size_t reserved_;
   uint8_t *buf_;
   uint8_t *cur_;  // Points at location between empty (below) and used (above).
+  size_t segment_size_;
+  uoffset_t base_;  // Size of all data in segments_.
+  std::vector<Segment> segments_;  // Segments before buf_, oldest first.
+  bool fixed_;  // buf_ is not ours, see set_fixed_buffer().
+  bool out_of_space_;
+  // Where small writes go that didn't fit in a fixed buffer.
+  largest_scalar_t scratch_[2];
+  #ifdef FLATBUFFERS_BUILDER_STATS
+    size_t reallocations_;
+    size_t bytes_copied_;
+  #endif
 
   void reallocate(size_t len) {
     assert(allocator_);
+    #ifdef FLATBUFFERS_BUILDER_STATS
+      reallocations_++;
+      // Allocators may grow in place, but can't be assumed to.
+      if (buf_ && !segment_size_) bytes_copied_ += reserved_;
+    #endif
+    if (segment_size_) {
+      add_segment(len);
+      return;
+    }
     auto old_reserved = reserved_;
     auto old_size = size();
     reserved_ += (std::max)(len, growth_policy(old_reserved));
@@ -647,6 +1166,171 @@ class vector_downward {
     }
     cur_ = buf_ + reserved_ - old_size;
   }
+
+  void add_segment(size_t len) {
+    auto old_size = size();
+    if (buf_) {
+      if (old_size == base_) {
+        // Nothing was written to the current segment, don't keep it around.
+        allocator_->deallocate(buf_, reserved_);
+      } else {
+        Segment segment = { buf_, reserved_, cur_, base_ };
+        segments_.push_back(segment);
+      }
+    }
+    // Size the segment such that its end is aligned the same way the end of
+    // a contiguous buffer would be, relative to the data in it.
+    FLATBUFFERS_CONSTEXPR size_t alignment = AlignOf<largest_scalar_t>();
+    reserved_ = (std::max)(len, segments_.empty() && !old_size ? initial_size_
+                                                               : segment_size_);
+    reserved_ = ((reserved_ + alignment - 1) & ~(alignment - 1)) +
+                PaddingBytes(old_size, alignment);
+    buf_ = allocator_->allocate(reserved_);
+    cur_ = buf_ + reserved_;
+    base_ = old_size;
+  }
+
+  uint8_t *overflow(size_t len) {
+    out_of_space_ = true;
+    return len <= sizeof(scratch_) ? reinterpret_cast<uint8_t *>(scratch_)
+                                   : nullptr;
+  }
+
+  void pop_segment() {
+    allocator_->deallocate(buf_, reserved_);
+    auto &segment = segments_.back();
+    buf_ = segment.buf;
+    reserved_ = segment.reserved;
+    cur_ = segment.cur;
+    base_ = segment.base;
+    segments_.pop_back();
+  }
+
+  void free_segments() {
+    for (auto it = segments_.begin(); it != segments_.end(); ++it) {
+      if (it->buf) allocator_->deallocate(it->buf, it->reserved);
+    }
+    segments_.clear();
+    base_ = 0;
+  }
+
+  uint8_t *segment_data_at(size_t offset) const {
+    // Find the last segment that starts before offset.
+    auto it = segments_.end() - 1;
+    while (it != segments_.begin() && offset <= it->base) --it;
+    return it->buf + it->reserved - (offset - it->base);
+  }
+};
+
+// 32bit FNV-1a over an arbitrary byte range. Used to index serialized data
+// in the builder (see OffsetHashIndex below). flatc embeds the hashes of
+// vtables in generated code (see EndTableWithVtable), so it can't change
+// without regenerating code. See hash.h for the user-facing hash functions.
+inline uint32_t HashBytes(const uint8_t *bytes, size_t len,
+                          uint32_t hash = 0x811C9DC5) {
+  for (size_t i = 0; i < len; i++) {
+    hash ^= bytes[i];
+    hash *= 0x01000193;
+  }
+  return hash;
+}
+
+// Hashes of keys, as stored in the indices made by
+// FlatBufferBuilder::CreateKeyHashIndex. Since these end up in buffers, they
+// can't change. Scalar keys are hashed as their bytes in little endian, so
+// e.g. 0.0 and -0.0 hash differently. String keys are hashed up to their
+// first 0 byte, since that is where the key comparisons (strcmp) stop.
+inline uint32_t HashKey(const char *key) {
+  return HashBytes(reinterpret_cast<const uint8_t *>(key), strlen(key));
+}
+
+inline uint32_t HashKey(const String *key) { return HashKey(key->c_str()); }
+
+template<typename T> uint32_t HashKey(T key) {
+  auto le = EndianScalar(key);
+  return HashBytes(reinterpret_cast<const uint8_t *>(&le), sizeof(T));
+}
+
+// An open-addressed hash index of objects already serialized into a
+// vector_downward, stored as offsets relative to the end of the buffer.
+// Since those offsets don't change when the buffer grows, neither does the
+// index. The caller supplies the hash of the object, and an equality functor
+// that compares a candidate offset against the object being looked up, so the
+// index itself never has to look at the buffer.
+class OffsetHashIndex {
+ public:
+  OffsetHashIndex() : size_(0) {}
+
+  // Returns the offset of an object with this hash for which `equal(offset)`
+  // holds, or 0 if there is none.
+  template<typename F> uoffset_t Find(uint32_t hash, F equal) const {
+    if (slots_.empty()) return 0;
+    auto mask = slots_.size() - 1;
+    for (auto i = hash & mask; slots_[i].off; i = (i + 1) & mask) {
+      if (slots_[i].hash == hash && equal(slots_[i].off)) return slots_[i].off;
+    }
+    return 0;
+  }
+
+  // Adds an offset to the index. It does not check for duplicates.
+  void Insert(uint32_t hash, uoffset_t off) {
+    assert(off);  // 0 marks an empty slot.
+    // Keep the load factor at or below 1/2.
+    if ((size_ + 1) * 2 > slots_.size()) Grow();
+    InsertSlot(hash, off);
+    size_++;
+  }
+
+  // Makes room for `n` entries, so inserting them won't allocate.
+  void Reserve(size_t n) {
+    while (n * 2 > slots_.size()) Grow();
+  }
+
+  // Calls `f(hash, offset)` for all entries.
+  template<typename F> void ForEach(F f) const {
+    for (auto it = slots_.begin(); it != slots_.end(); ++it) {
+      if (it->off) f(it->hash, it->off);
+    }
+  }
+
+  // Whether the next Insert() would have to allocate.
+  bool full() const { return (size_ + 1) * 2 > slots_.size(); }
+
+  // Removes all entries, but keeps the memory around for reuse.
+  void Clear() {
+    if (size_) std::fill(slots_.begin(), slots_.end(), Slot());
+    size_ = 0;
+  }
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return slots_.size(); }
+
+ private:
+  struct Slot {
+    Slot() : hash(0), off(0) {}
+    uint32_t hash;
+    uoffset_t off;
+  };
+
+  void InsertSlot(uint32_t hash, uoffset_t off) {
+    auto mask = slots_.size() - 1;
+    auto i = hash & mask;
+    while (slots_[i].off) i = (i + 1) & mask;
+    slots_[i].hash = hash;
+    slots_[i].off = off;
+  }
+
+  void Grow() {
+    std::vector<Slot> old;
+    old.swap(slots_);
+    slots_.resize(old.empty() ? 16 : old.size() * 2);
+    for (auto it = old.begin(); it != old.end(); ++it) {
+      if (it->off) InsertSlot(it->hash, it->off);
+    }
+  }
+
+  std::vector<Slot> slots_;  // Size is always 0 or a power of 2.
+  size_t size_;
 };
 
 // Converts a Field ID to a virtual table offset.
@@ -689,16 +1373,12 @@ class FlatBufferBuilder
                              bool own_allocator = false)
     : buf_(initial_size, allocator, own_allocator), max_voffset_(0),
       nested(false), finished(false), minalign_(1), force_defaults_(false),
-      dedup_vtables_(true), string_pool(nullptr) {
+      dedup_vtables_(true), dedup_tables_(false), shared_bytes_saved_(0) {
     offsetbuf_.reserve(16);  // Avoid first few reallocs.
     vtables_.reserve(16);
     EndianCheck();
   }
 
-  ~FlatBufferBuilder() {
-    if (string_pool) delete string_pool;
-  }
-
   void Reset() {
     Clear();  // clear builder state
     buf_.reset();  // deallocate buffer
@@ -712,8 +1392,15 @@ class FlatBufferBuilder
     nested = false;
     finished = false;
     vtables_.clear();
+    vtable_index_.Clear();
     minalign_ = 1;
-    if (string_pool) string_pool->clear();
+    string_pool.Clear();
+    table_pool_.Clear();
+    vector_pool_.Clear();
+    shared_bytes_saved_ = 0;
+    #ifdef FLATBUFFERS_BUILDER_STATS
+      stats_ = BuilderStats();
+    #endif
   }
 
   /// @brief The current size of the serialized buffer, counting from the end.
@@ -725,9 +1412,21 @@ class FlatBufferBuilder
   /// buffer.
   uint8_t *GetBufferPointer() const {
     Finished();
+    // If you hit this, the buffer is spread over several segments, see
+    // UseSegments().
+    assert(buf_.is_contiguous());
     return buf_.data();
   }
 
+  /// @brief Get the serialized buffer (after you call `Finish()`) as a list
+  /// of memory regions, which may be more than one when using `UseSegments()`.
+  /// @return Returns (pointer, size) pairs in the order they appear in the
+  /// buffer, suitable for e.g. `writev`.
+  std::vector<std::pair<const uint8_t *, size_t>> GetBufferSegments() const {
+    Finished();
+    return buf_.get_segments();
+  }
+
   /// @brief Get a pointer to an unfinished buffer.
   /// @return Returns a `uint8_t` pointer to the unfinished buffer.
   uint8_t *GetCurrentBufferPointer() const { return buf_.data(); }
@@ -743,6 +1442,8 @@ class FlatBufferBuilder
   }
 
   /// @brief Get the released DetachedBuffer.
+  /// Unless the builder owns its allocator, it may be used again after
+  /// calling `Clear()`.
   /// @return A `DetachedBuffer` that owns the buffer and its allocator.
   DetachedBuffer Release() {
     Finished();
@@ -779,12 +1480,102 @@ class FlatBufferBuilder
   /// @param[in] bool dedup When set to `true`, dedup vtables.
   void DedupVtables(bool dedup) { dedup_vtables_ = dedup; }
 
+  /// @brief Makes `EndTable()` check whether an identical table was written
+  /// before, and if so, drop the new table and return the existing one.
+  /// Tables are identical when their fields are, where offset fields must
+  /// refer to the same object, so tables referring to identical children are
+  /// found when the children were deduplicated first (with this, or with
+  /// `CreateSharedString()` / `CreateSharedVector()`).
+  /// Not supported with `UseSegments()`, where this does nothing.
+  /// To get identical layouts, each table then starts aligned to the largest
+  /// alignment used in the buffer so far, which costs up to that many bytes
+  /// of padding per table. Tables written before that alignment was first
+  /// used are not shared with later ones; to avoid that, call `Align()` with
+  /// the largest alignment of any of the types first.
+  /// @param[in] bool dedup When set to `true`, dedup tables.
+  void DedupTables(bool dedup) { dedup_tables_ = dedup; }
+
+  #ifdef FLATBUFFERS_BUILDER_STATS
+  /// @brief Counters describing how the current buffer was built (since the
+  /// last `Clear()`), e.g. to read after `Finish()` and aggregate per
+  /// message type. Only available when `FLATBUFFERS_BUILDER_STATS` is defined.
+  BuilderStats GetStats() const {
+    auto stats = stats_;
+    stats.reallocations = buf_.reallocations();
+    stats.bytes_copied = buf_.bytes_copied();
+    return stats;
+  }
+  #endif
+
+  /// @brief The number of bytes that were not written because an identical
+  /// object was already in the buffer, see `CreateSharedString()`,
+  /// `CreateSharedVector()` and `DedupTables()`.
+  size_t GetSharedBytesSaved() const { return shared_bytes_saved_; }
+
+  /// @brief By default the buffer is a single block of memory, which is
+  /// reallocated and copied as the buffer grows. Instead, this makes the
+  /// buffer grow by adding segments, so existing data is never copied.
+  /// Read the finished buffer with `GetBufferSegments()`, or call
+  /// `FinishContiguous()` (or `Release()`) to copy it into a single block once.
+  /// Tables may straddle segments, so this does not support (and asserts in)
+  /// `CreateVectorOfSortedTables()`, `CreateVectorOfEytzingerTables()`,
+  /// `CreateKeyHashIndex()` for tables, and `GetTemporaryPointer()`.
+  /// Must be called before anything is written to the buffer.
+  /// @param[in] segment_size The minimum size of each new segment, or 0 to
+  /// turn segments off again.
+  void UseSegments(size_t segment_size) {
+    assert(!GetSize());
+    buf_.set_segment_size(segment_size);
+  }
+
+  /// @brief Whether `UseSegments()` is on. Tables may then straddle segments,
+  /// so they can't be read in place while building.
+  bool IsSegmented() const { return buf_.is_segmented(); }
+
+  /// @brief Makes the builder write into a caller supplied buffer, for code
+  /// that must not allocate (e.g. real-time paths). Instead of growing, the
+  /// builder sets `IsOutOfSpace()` when a message doesn't fit, which must be
+  /// checked before using the finished buffer. Once the scratch space for
+  /// building tables is reserved here, building a message that fits performs
+  /// no allocations at all.
+  /// Must be called before anything is written to the buffer. `Reset()` goes
+  /// back to allocating.
+  /// @param[in] buf The memory to build into. Its end should be aligned to the
+  /// largest scalar or struct used.
+  /// @param[in] size The size of `buf` in bytes.
+  /// @param[in] max_fields The most fields set on a single table.
+  /// @param[in] max_vtables The number of distinct vtables to deduplicate,
+  /// vtables beyond that are still written, just not shared.
+  /// @param[in] max_shared_strings The number of strings to deduplicate in
+  /// `CreateSharedString()`, strings beyond that are written as-is.
+  /// Tables and vectors are not shared in this mode (see `DedupTables()`).
+  void UseFixedBuffer(uint8_t *buf, size_t size, size_t max_fields = 64,
+                      size_t max_vtables = 64, size_t max_shared_strings = 64) {
+    assert(!GetSize());
+    buf_.set_fixed_buffer(buf, size);
+    std::vector<FieldLoc>().swap(offsetbuf_);
+    offsetbuf_.reserve(max_fields);
+    std::vector<uoffset_t>().swap(vtables_);
+    vtables_.reserve(max_vtables);
+    vtable_index_.Reserve(vtables_.capacity());
+    string_pool.Reserve(max_shared_strings);
+  }
+
+  /// @brief Whether the buffer given to `UseFixedBuffer()` (or the scratch
+  /// space reserved there) ran out while building the current buffer. If so,
+  /// its contents are incomplete. Reset by `Clear()`.
+  bool IsOutOfSpace() const { return buf_.out_of_space(); }
+
   /// @cond FLATBUFFERS_INTERNAL
   void Pad(size_t num_bytes) { buf_.fill(num_bytes); }
 
   void Align(size_t elem_size) {
     if (elem_size > minalign_) minalign_ = elem_size;
-    buf_.fill(PaddingBytes(buf_.size(), elem_size));
+    auto padding = PaddingBytes(buf_.size(), elem_size);
+    #ifdef FLATBUFFERS_BUILDER_STATS
+      stats_.padding_bytes += padding;
+    #endif
+    buf_.fill(padding);
   }
 
   void PushFlatBuffer(const uint8_t *bytes, size_t size) {
@@ -819,8 +1610,12 @@ class FlatBufferBuilder
 
   // When writing fields, we track where they are, so we can create correct
   // vtables later.
-  void TrackField(voffset_t field, uoffset_t off) {
-    FieldLoc fl = { off, field };
+  void TrackField(voffset_t field, uoffset_t off, bool is_offset = false) {
+    if (offsetbuf_.size() == offsetbuf_.capacity() && buf_.is_fixed()) {
+      buf_.set_out_of_space();  // See UseFixedBuffer().
+      return;
+    }
+    FieldLoc fl = { off, field, is_offset };
     offsetbuf_.push_back(fl);
     max_voffset_ = (std::max)(max_voffset_, field);
   }
@@ -835,7 +1630,8 @@ class FlatBufferBuilder
 
   template<typename T> void AddOffset(voffset_t field, Offset<T> off) {
     if (off.IsNull()) return;  // Don't store.
-    AddElement(field, ReferTo(off.o), static_cast<uoffset_t>(0));
+    // Tracked as an offset for DedupTables().
+    TrackField(field, PushElement(ReferTo(off.o)), true);
   }
 
   template<typename T> void AddStruct(voffset_t field, const T *structptr) {
@@ -876,6 +1672,10 @@ class FlatBufferBuilder
   // with a sequence of AddElement calls in between.
   uoffset_t StartTable() {
     NotNested();
+    // Identical tables only get identical padding (and so vtables) if they
+    // start at the same alignment, see DedupTables(). The largest alignment
+    // used so far is the one the buffer gets padded to anyway.
+    if (dedup_tables_) Align(minalign_);
     nested = true;
     return GetSize();
   }
@@ -898,6 +1698,13 @@ class FlatBufferBuilder
                                                      sizeof(voffset_t)),
                               FieldIndexToOffset(0));
     buf_.fill_big(max_voffset_);
+    if (IsOutOfSpace()) {
+      // The vtable (or the table) didn't make it into the buffer, the
+      // result is garbage anyway.
+      ClearOffsets();
+      nested = false;
+      return vtableoffsetloc;
+    }
     auto table_object_size = vtableoffsetloc - start;
     assert(table_object_size < 0x10000);  // Vtable use 16bit offsets.
     WriteScalar<voffset_t>(buf_.data() + sizeof(voffset_t),
@@ -912,25 +1719,43 @@ class FlatBufferBuilder
       assert(!ReadScalar<voffset_t>(buf_.data() + field_location->id));
       WriteScalar<voffset_t>(buf_.data() + field_location->id, pos);
     }
-    ClearOffsets();
-    auto vt1 = reinterpret_cast<voffset_t *>(buf_.data());
+    auto vt1 = buf_.data();
     auto vt1_size = ReadScalar<voffset_t>(vt1);
     auto vt_use = GetSize();
     // See if we already have generated a vtable with this exact same
     // layout before. If so, make it point to the old one, remove this one.
+    // The index only ever holds the first vtable with a given layout, so
+    // this finds the same vtable a linear scan over vtables_ would. Without
+    // dedup, vtables aren't indexed at all, so turning it on later only
+    // shares the vtables made from then on.
+    uint32_t vt_hash = 0;
+    uoffset_t vt_found = 0;
     if (dedup_vtables_) {
-      for (auto it = vtables_.begin(); it != vtables_.end(); ++it) {
-        auto vt2 = reinterpret_cast<voffset_t *>(buf_.data_at(*it));
-        auto vt2_size = *vt2;
-        if (vt1_size != vt2_size || memcmp(vt2, vt1, vt1_size)) continue;
-        vt_use = *it;
+      vt_hash = HashBytes(vt1, vt1_size);
+      vt_found = vtable_index_.Find(vt_hash, [&](uoffset_t off) {
+        auto vt2 = buf_.data_at(off);
+        return ReadScalar<voffset_t>(vt2) == vt1_size &&
+               !memcmp(vt2, vt1, vt1_size);
+      });
+      if (vt_found) {
+        vt_use = vt_found;
         buf_.pop(GetSize() - vtableoffsetloc);
-        break;
       }
     }
-    // If this is a new vtable, remember it.
-    if (vt_use == GetSize()) {
+    #ifdef FLATBUFFERS_BUILDER_STATS
+      if (vt_use == vt_found) {
+        stats_.vtables_deduped++;
+      } else {
+        stats_.vtables_created++;
+      }
+      stats_.peak_fields = (std::max)(stats_.peak_fields, offsetbuf_.size());
+    #endif
+    // If this is a new vtable, remember it (if there's room, see
+    // UseFixedBuffer()).
+    if (vt_use == GetSize() &&
+        (vtables_.size() < vtables_.capacity() || !buf_.is_fixed())) {
       vtables_.push_back(vt_use);
+      if (dedup_vtables_) vtable_index_.Insert(vt_hash, vt_use);
     }
     // Fill the vtable offset we created above.
     // The offset points from the beginning of the object to where the
@@ -940,9 +1765,11 @@ class FlatBufferBuilder
     WriteScalar(buf_.data_at(vtableoffsetloc),
                 static_cast<soffset_t>(vt_use) -
                   static_cast<soffset_t>(vtableoffsetloc));
-
+    auto table = vtableoffsetloc;
+    if (dedup_tables_) table = ShareTable(start, vtableoffsetloc, vt_use);
+    ClearOffsets();
     nested = false;
-    return vtableoffsetloc;
+    return table;
   }
 
   // DEPRECATED: call the version above instead.
@@ -950,11 +1777,82 @@ class FlatBufferBuilder
     return EndTable(start);
   }
 
+  // Like EndTable(), for tables whose fields were written without tracking
+  // them, in a layout that is known ahead of time (see the CreateXDense
+  // functions generated with --gen-dense-create). `vtable` is the resulting
+  // vtable (in native endianness), and `vtable_hash` its HashBytes() (in
+  // little endian), so it is only ever compared against existing vtables.
+  uoffset_t EndTableWithVtable(uoffset_t start, const voffset_t *vtable,
+                               uint32_t vtable_hash) {
+    assert(nested && offsetbuf_.empty());
+    auto vtableoffsetloc = PushElement<soffset_t>(0);
+    // If this fails, the table was not written in the layout the vtable was
+    // computed for.
+    assert(vtableoffsetloc - start == vtable[1]);
+    nested = false;
+    if (IsOutOfSpace()) return vtableoffsetloc;
+    auto vt_size = vtable[0];
+    uoffset_t vt_found = 0;
+    if (dedup_vtables_) {
+      vt_found = vtable_index_.Find(vtable_hash, [&](uoffset_t off) {
+        auto vt2 = buf_.data_at(off);
+        if (ReadScalar<voffset_t>(vt2) != vt_size) return false;
+        for (size_t i = 1; i < vt_size / sizeof(voffset_t); i++) {
+          if (ReadScalar<voffset_t>(vt2 + i * sizeof(voffset_t)) !=
+              vtable[i]) {
+            return false;
+          }
+        }
+        return true;
+      });
+    }
+    uoffset_t vt_use = vt_found;
+    #ifdef FLATBUFFERS_BUILDER_STATS
+      if (vt_found) {
+        stats_.vtables_deduped++;
+      } else {
+        stats_.vtables_created++;
+      }
+    #endif
+    if (!vt_found) {
+      auto vt = buf_.make_space(vt_size);
+      // vt is null if it didn't fit in a fixed buffer.
+      for (size_t i = 0; vt && i < vt_size / sizeof(voffset_t); i++) {
+        WriteScalar(vt + i * sizeof(voffset_t), vtable[i]);
+      }
+      vt_use = GetSize();
+      if (!IsOutOfSpace() &&
+          (vtables_.size() < vtables_.capacity() || !buf_.is_fixed())) {
+        vtables_.push_back(vt_use);
+        if (dedup_vtables_) vtable_index_.Insert(vtable_hash, vt_use);
+      }
+    }
+    WriteScalar(buf_.data_at(vtableoffsetloc),
+                static_cast<soffset_t>(vt_use) -
+                  static_cast<soffset_t>(vtableoffsetloc));
+    return vtableoffsetloc;
+  }
+
+  // The `vtable_hash` EndTableWithVtable() expects for `vtable`, for when
+  // the vtable isn't known ahead of time.
+  static uint32_t HashVtable(const voffset_t *vtable) {
+    auto hash = HashBytes(nullptr, 0);
+    for (size_t i = 0; i < vtable[0] / sizeof(voffset_t); i++) {
+      auto le = EndianScalar(vtable[i]);
+      hash = HashBytes(reinterpret_cast<const uint8_t *>(&le), sizeof(le),
+                       hash);
+    }
+    return hash;
+  }
+
   // This checks a required field has been set in a given table that has
   // just been constructed.
   template<typename T> void Required(Offset<T> table, voffset_t field) {
+    if (IsOutOfSpace()) return;  // The table may not have been written.
     auto table_ptr = buf_.data_at(table.o);
-    auto vtable_ptr = table_ptr - ReadScalar<soffset_t>(table_ptr);
+    // Find the vtable by its offset in the buffer, since it may not be in the
+    // same segment as the table.
+    auto vtable_ptr = buf_.data_at(table.o + ReadScalar<soffset_t>(table_ptr));
     bool ok = ReadScalar<voffset_t>(vtable_ptr + field) != 0;
     // If this fails, the caller will show what field needs to be set.
     assert(ok);
@@ -976,7 +1874,11 @@ class FlatBufferBuilder
   // Aligns such that when "len" bytes are written, an object can be written
   // after it with "alignment" without padding.
   void PreAlign(size_t len, size_t alignment) {
-    buf_.fill(PaddingBytes(GetSize() + len, alignment));
+    auto padding = PaddingBytes(GetSize() + len, alignment);
+    #ifdef FLATBUFFERS_BUILDER_STATS
+      stats_.padding_bytes += padding;
+    #endif
+    buf_.fill(padding);
   }
   template<typename T> void PreAlign(size_t len) {
     AssertScalarT<T>();
@@ -990,6 +1892,8 @@ class FlatBufferBuilder
   /// @return Returns the offset in the buffer where the string starts.
   Offset<String> CreateString(const char *str, size_t len) {
     NotNested();
+    // Keep the whole string in one segment, see UseSegments().
+    if (buf_.is_segmented()) buf_.ensure_space(len + 1 + 2 * sizeof(uoffset_t));
     PreAlign<uoffset_t>(len + 1);  // Always 0-terminated.
     buf_.fill(1);
     PushBytes(reinterpret_cast<const uint8_t *>(str), len);
@@ -1034,21 +1938,30 @@ class FlatBufferBuilder
   /// @param[in] len The number of bytes that should be stored from `str`.
   /// @return Returns the offset in the buffer where the string starts.
   Offset<String> CreateSharedString(const char *str, size_t len) {
-    if (!string_pool)
-      string_pool = new StringOffsetMap(StringOffsetCompare(buf_));
-    auto size_before_string = buf_.size();
-    // Must first serialize the string, since the set is all offsets into
-    // buffer.
-    auto off = CreateString(str, len);
-    auto it = string_pool->find(off);
+    NotNested();
+    auto hash = HashBytes(reinterpret_cast<const uint8_t *>(str), len);
+    auto existing = string_pool.Find(hash, [&](uoffset_t off) {
+      auto pooled = reinterpret_cast<const String *>(buf_.data_at(off));
+      return pooled->size() == len && !memcmp(pooled->c_str(), str, len);
+    });
+    #ifdef FLATBUFFERS_BUILDER_STATS
+      if (existing) {
+        stats_.string_pool_hits++;
+      } else {
+        stats_.string_pool_misses++;
+      }
+    #endif
     // If it exists we reuse existing serialized data!
-    if (it != string_pool->end()) {
-      // We can remove the string we serialized.
-      buf_.pop(buf_.size() - size_before_string);
-      return *it;
+    if (existing) {
+      shared_bytes_saved_ += PaddingBytes(GetSize() + len + 1,
+                                          sizeof(uoffset_t)) +
+                             len + 1 + sizeof(uoffset_t);
+      return Offset<String>(existing);
     }
+    auto off = CreateString(str, len);
     // Record this string for future use.
-    string_pool->insert(off);
+    if (IsOutOfSpace() || (buf_.is_fixed() && string_pool.full())) return off;
+    string_pool.Insert(hash, off.o);
     return off;
   }
 
@@ -1089,6 +2002,10 @@ class FlatBufferBuilder
   void StartVector(size_t len, size_t elemsize) {
     NotNested();
     nested = true;
+    // Keep the whole vector in one segment, see UseSegments().
+    if (buf_.is_segmented()) {
+      buf_.ensure_space(len * elemsize + elemsize + 2 * sizeof(uoffset_t));
+    }
     PreAlign<uoffset_t>(len * elemsize);
     PreAlign(len * elemsize, elemsize);  // Just in case elemsize > uoffset_t.
   }
@@ -1250,7 +2167,8 @@ class FlatBufferBuilder
   template<typename T> Offset<Vector<const T *>> CreateVectorOfStructs(
       size_t vector_size, const std::function<void(size_t i, T *)> &filler) {
     T* structs = StartVectorOfStructs<T>(vector_size);
-    for (size_t i = 0; i < vector_size; i++) {
+    // structs is null if the vector doesn't fit in a fixed buffer.
+    for (size_t i = 0; structs && i < vector_size; i++) {
       filler(i, structs);
       structs++;
     }
@@ -1270,7 +2188,8 @@ class FlatBufferBuilder
   template <typename T, typename F, typename S> Offset<Vector<const T *>>
       CreateVectorOfStructs(size_t vector_size, F f, S *state) {
     T* structs = StartVectorOfStructs<T>(vector_size);
-    for (size_t i = 0; i < vector_size; i++) {
+    // structs is null if the vector doesn't fit in a fixed buffer.
+    for (size_t i = 0; structs && i < vector_size; i++) {
       f(i, structs, state);
       structs++;
     }
@@ -1300,32 +2219,106 @@ class FlatBufferBuilder
     return CreateVectorOfNativeStructs<T, S>(data(v), v.size());
   }
 
-
-  /// @cond FLATBUFFERS_INTERNAL
-  template<typename T>
-  struct StructKeyComparator {
-    bool operator()(const T &a, const T &b) const {
-      return a.KeyCompareLessThan(&b);
-    }
-
-  private:
-    StructKeyComparator& operator= (const StructKeyComparator&);
-  };
-  /// @endcond
-
-  /// @brief Serialize a `std::vector` of structs into a FlatBuffer `vector`
-  /// in sorted order.
-  /// @tparam T The data type of the `std::vector` struct elements.
-  /// @param[in]] v A const reference to the `std::vector` of structs to
-  /// serialize into the buffer as a `vector`.
+  /// @brief Serialize an array into a FlatBuffer `vector`, unless a `vector`
+  /// with the same contents was created with `CreateShared*()` before, in
+  /// which case the existing one is returned.
+  /// Not supported with `UseSegments()`, where this never shares.
+  /// @tparam T The data type of the array elements.
+  /// @param[in] v A pointer to the array of type `T` to serialize into the
+  /// buffer as a `vector`.
+  /// @param[in] len The number of elements to serialize.
   /// @return Returns a typed `Offset` into the serialized data indicating
   /// where the vector is stored.
-  template<typename T> Offset<Vector<const T *>> CreateVectorOfSortedStructs(
-      std::vector<T> *v) {
-    return CreateVectorOfSortedStructs(data(*v), v->size());
+  template<typename T> Offset<Vector<T>> CreateSharedVector(const T *v,
+                                                            size_t len) {
+    auto size = GetSize();
+    auto off = CreateVector(v, len);
+    return ShareVector(off, size, sizeof(T), AlignOf<T>(), false);
+  }
+
+  /// @brief Serialize an array of offsets into a FlatBuffer `vector`, unless
+  /// a `vector` referring to the same objects was created with
+  /// `CreateShared*()` before, in which case the existing one is returned.
+  /// @tparam T The data type the offsets refer to.
+  /// @param[in] v A pointer to the array of offsets to serialize.
+  /// @param[in] len The number of elements to serialize.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T> Offset<Vector<Offset<T>>> CreateSharedVector(
+      const Offset<T> *v, size_t len) {
+    auto size = GetSize();
+    auto off = CreateVector(v, len);
+    return ShareVector(off, size, sizeof(uoffset_t), sizeof(uoffset_t), true);
   }
 
-  /// @brief Serialize a `std::vector` of native structs into a FlatBuffer `vector`
+  /// @brief Serialize a `std::vector` into a FlatBuffer `vector`, unless a
+  /// `vector` with the same contents was created with `CreateShared*()`
+  /// before, in which case the existing one is returned.
+  /// @tparam T The data type of the `std::vector` elements.
+  /// @param v A const reference to the `std::vector` to serialize into the
+  /// buffer as a `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T> Offset<Vector<T>> CreateSharedVector(
+      const std::vector<T> &v) {
+    return CreateSharedVector(data(v), v.size());
+  }
+
+  /// @brief Serialize an array of structs into a FlatBuffer `vector`, unless
+  /// a `vector` with the same contents was created with `CreateShared*()`
+  /// before, in which case the existing one is returned.
+  /// @tparam T The data type of the struct array elements.
+  /// @param[in] v A pointer to the array of type `T` to serialize into the
+  /// buffer as a `vector`.
+  /// @param[in] len The number of elements to serialize.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T> Offset<Vector<const T *>> CreateSharedVectorOfStructs(
+      const T *v, size_t len) {
+    auto size = GetSize();
+    auto off = CreateVectorOfStructs(v, len);
+    return ShareVector(off, size, sizeof(T), AlignOf<T>(), false);
+  }
+
+  /// @brief Serialize a `std::vector` of structs into a FlatBuffer `vector`,
+  /// unless a `vector` with the same contents was created with
+  /// `CreateShared*()` before, in which case the existing one is returned.
+  /// @tparam T The data type of the `std::vector` struct elements.
+  /// @param[in] v A const reference to the `std::vector` of structs to
+  /// serialize into the buffer as a `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T> Offset<Vector<const T *>> CreateSharedVectorOfStructs(
+      const std::vector<T> &v) {
+    return CreateSharedVectorOfStructs(data(v), v.size());
+  }
+
+
+  /// @cond FLATBUFFERS_INTERNAL
+  template<typename T>
+  struct StructKeyComparator {
+    bool operator()(const T &a, const T &b) const {
+      return a.KeyCompareLessThan(&b);
+    }
+
+  private:
+    StructKeyComparator& operator= (const StructKeyComparator&);
+  };
+  /// @endcond
+
+  /// @brief Serialize a `std::vector` of structs into a FlatBuffer `vector`
+  /// in sorted order.
+  /// @tparam T The data type of the `std::vector` struct elements.
+  /// @param[in]] v A const reference to the `std::vector` of structs to
+  /// serialize into the buffer as a `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T> Offset<Vector<const T *>> CreateVectorOfSortedStructs(
+      std::vector<T> *v) {
+    return CreateVectorOfSortedStructs(data(*v), v->size());
+  }
+
+  /// @brief Serialize a `std::vector` of native structs into a FlatBuffer `vector`
   /// in sorted order.
   /// @tparam T The data type of the `std::vector` struct elements.
   /// @tparam S The data type of the `std::vector` native struct elements.
@@ -1396,7 +2389,11 @@ class FlatBufferBuilder
   /// where the vector is stored.
   template<typename T> Offset<Vector<Offset<T>>> CreateVectorOfSortedTables(
       Offset<T> *v, size_t len) {
-    std::sort(v, v + len, TableKeyComparator<T>(buf_));
+    // If you hit this, the tables can't be compared in place, see
+    // UseSegments().
+    assert(!buf_.is_segmented());
+    // Tables that didn't fit in a fixed buffer can't be compared.
+    if (!IsOutOfSpace()) std::sort(v, v + len, TableKeyComparator<T>(buf_));
     return CreateVector(v, len);
   }
 
@@ -1412,21 +2409,116 @@ class FlatBufferBuilder
     return CreateVectorOfSortedTables(data(*v), v->size());
   }
 
+  /// @brief Serialize an array of `table` offsets as a `vector` in the buffer
+  /// in Eytzinger order, for fast lookups with `LookupByKeyEytzinger()`.
+  /// Iterate over it in sorted order with `EytzingerFirst()` and
+  /// `EytzingerNext()`.
+  /// @tparam T The data type that the offset refers to.
+  /// @param[in] v An array of type `Offset<T>` that contains the `table`
+  /// offsets to store in the buffer. It is sorted as a side effect.
+  /// @param[in] len The number of elements to store in the `vector`.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T> Offset<Vector<Offset<T>>> CreateVectorOfEytzingerTables(
+      Offset<T> *v, size_t len) {
+    assert(!buf_.is_segmented());  // See CreateVectorOfSortedTables().
+    if (!IsOutOfSpace()) std::sort(v, v + len, TableKeyComparator<T>(buf_));
+    std::vector<Offset<T>> tree(len);
+    EytzingerOrder(v, len, data(tree));
+    return CreateVector(tree);
+  }
+
+  /// @brief Serialize an array of `table` offsets as a `vector` in the buffer
+  /// in Eytzinger order, see above.
+  template<typename T> Offset<Vector<Offset<T>>> CreateVectorOfEytzingerTables(
+      std::vector<Offset<T>> *v) {
+    return CreateVectorOfEytzingerTables(data(*v), v->size());
+  }
+
+  /// @brief Serialize an array of structs into a FlatBuffer `vector` in
+  /// Eytzinger order, for fast lookups with `LookupByKeyEytzinger()`.
+  /// @tparam T The data type of the struct array elements.
+  /// @param[in] v A pointer to the array of type `T` to serialize into the
+  /// buffer as a `vector`. It is sorted as a side effect.
+  /// @param[in] len The number of elements to serialize.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the vector is stored.
+  template<typename T> Offset<Vector<const T *>> CreateVectorOfEytzingerStructs(
+      T *v, size_t len) {
+    std::sort(v, v + len, StructKeyComparator<T>());
+    std::vector<T> tree(len);
+    EytzingerOrder(v, len, data(tree));
+    return CreateVectorOfStructs(tree);
+  }
+
+  /// @brief Serialize a `std::vector` of structs into a FlatBuffer `vector`
+  /// in Eytzinger order, see above.
+  template<typename T> Offset<Vector<const T *>> CreateVectorOfEytzingerStructs(
+      std::vector<T> *v) {
+    return CreateVectorOfEytzingerStructs(data(*v), v->size());
+  }
+
+  /// @brief Serialize a hash index for a vector of tables with a key, for
+  /// expected O(1) lookups with `Vector::LookupByKey(key, index)`. Store it
+  /// in a field next to the vector; readers that don't know about it can
+  /// ignore it, and still use the (sorted) vector as usual.
+  /// @tparam T The data type that the offsets of the vector refer to.
+  /// @param[in] vec The vector to index, serialized earlier in this buffer.
+  /// @return Returns a typed `Offset` into the serialized data indicating
+  /// where the index is stored.
+  template<typename T> Offset<Vector<uint32_t>> CreateKeyHashIndex(
+      Offset<Vector<Offset<T>>> vec) {
+    // If you hit this, the keys can't be read in place, see UseSegments().
+    assert(!buf_.is_segmented());
+    std::vector<uint32_t> hashes;
+    // Tables that didn't fit in a fixed buffer can't be hashed.
+    if (!IsOutOfSpace()) {
+      auto size = ReadScalar<uoffset_t>(buf_.data_at(vec.o));
+      hashes.reserve(size);
+      for (uoffset_t i = 0; i < size; i++) {
+        auto elem = vec.o - static_cast<uoffset_t>(sizeof(uoffset_t)) * (i + 1);
+        auto table = elem - ReadScalar<uoffset_t>(buf_.data_at(elem));
+        hashes.push_back(
+          reinterpret_cast<const T *>(buf_.data_at(table))->KeyHash());
+      }
+    }
+    return BuildKeyHashIndex(hashes);
+  }
+
+  /// @brief Serialize a hash index for a vector of structs with a key, see
+  /// above.
+  template<typename T> Offset<Vector<uint32_t>> CreateKeyHashIndex(
+      Offset<Vector<const T *>> vec) {
+    std::vector<uint32_t> hashes;
+    if (!IsOutOfSpace()) {
+      auto v = reinterpret_cast<const Vector<const T *> *>(
+                 buf_.data_at(vec.o));
+      hashes.reserve(v->size());
+      for (uoffset_t i = 0; i < v->size(); i++) {
+        hashes.push_back(v->Get(i)->KeyHash());
+      }
+    }
+    return BuildKeyHashIndex(hashes);
+  }
+
   /// @brief Specialized version of `CreateVector` for non-copying use cases.
   /// Write the data any time later to the returned buffer pointer `buf`.
   /// @param[in] len The number of elements to store in the `vector`.
   /// @param[in] elemsize The size of each element in the `vector`.
   /// @param[out] buf A pointer to a `uint8_t` pointer that can be
   /// written to at a later time to serialize the data into a `vector`
-  /// in the buffer.
+  /// in the buffer. May be set to nullptr when the vector doesn't fit in
+  /// the buffer given to `UseFixedBuffer()`.
   uoffset_t CreateUninitializedVector(size_t len, size_t elemsize,
                                       uint8_t **buf) {
     NotNested();
     StartVector(len, elemsize);
-    buf_.make_space(len * elemsize);
+    auto dest = buf_.make_space(len * elemsize);
     auto vec_start = GetSize();
     auto vec_end = EndVector(len);
-    *buf = buf_.data_at(vec_start);
+    // A fixed buffer doesn't move, and when out of space `dest` is a scratch
+    // area or null, which mustn't be mistaken for buffer contents.
+    *buf = buf_.is_fixed() ? dest : buf_.data_at(vec_start);
     return vec_end;
   }
 
@@ -1451,6 +2543,75 @@ class FlatBufferBuilder
     return Offset<const T *>(GetSize());
   }
 
+  /// @brief Copy an object built with another builder into this one, e.g.
+  /// to build large buffers in parallel: subtrees are built in separate
+  /// builders on worker threads, then spliced into the final buffer.
+  /// All of `other` is copied, so it should contain just the subtree (and
+  /// not be finished). All offsets in a FlatBuffer are relative, so the
+  /// copy needs no fixups. The vtables and shared strings of `other` are
+  /// added to the ones this builder deduplicates against, though the copied
+  /// tables keep using their own vtables.
+  /// `other` is not modified, and may be cleared and reused afterwards.
+  /// It must not be building a table or vector, nor be out of space (see
+  /// `UseFixedBuffer()`).
+  /// @param[in] other The builder holding the subtree.
+  /// @param[in] root The offset of the subtree's root in `other`.
+  /// @return Returns the offset of the root in this builder.
+  template<typename T> Offset<T> Splice(const FlatBufferBuilder &other,
+                                        Offset<T> root) {
+    NotNested();
+    // If you hit this, `other` is still building a table or vector.
+    assert(&other != this && !other.nested);
+    // If you hit this, `other` ran out of its fixed buffer, and holds garbage.
+    assert(!other.IsOutOfSpace());
+    assert(root.o <= other.GetSize());
+    if (other.IsOutOfSpace()) {
+      // Without asserts, pass the error on instead of copying garbage.
+      buf_.set_out_of_space();
+      return Offset<T>(GetSize());
+    }
+    auto size = other.GetSize();
+    // Keep the copy in one segment, see UseSegments().
+    if (buf_.is_segmented()) buf_.ensure_space(size + other.minalign_);
+    // Offsets in `other` are relative to its end, which is aligned.
+    Align(other.minalign_);
+    auto regions = other.buf_.get_segments();
+    for (auto it = regions.rbegin(); it != regions.rend(); ++it) {
+      PushBytes(it->first, it->second);
+    }
+    auto base = GetSize() - size;
+    if (IsOutOfSpace()) return Offset<T>(base + root.o);
+    // Without dedup, vtables aren't indexed (see EndTable()).
+    if (dedup_vtables_) {
+      other.vtable_index_.ForEach([&](uint32_t hash, uoffset_t off) {
+        auto vt1 = buf_.data_at(base + off);
+        auto vt1_size = ReadScalar<voffset_t>(vt1);
+        auto vt_found = vtable_index_.Find(hash, [&](uoffset_t vt_off) {
+          auto vt2 = buf_.data_at(vt_off);
+          return ReadScalar<voffset_t>(vt2) == vt1_size &&
+                 !memcmp(vt2, vt1, vt1_size);
+        });
+        if (vt_found ||
+            (vtables_.size() == vtables_.capacity() && buf_.is_fixed())) {
+          return;
+        }
+        vtables_.push_back(base + off);
+        vtable_index_.Insert(hash, base + off);
+      });
+    }
+    other.string_pool.ForEach([&](uint32_t hash, uoffset_t off) {
+      auto str1 = reinterpret_cast<const String *>(buf_.data_at(base + off));
+      auto existing = string_pool.Find(hash, [&](uoffset_t str_off) {
+        auto str2 = reinterpret_cast<const String *>(buf_.data_at(str_off));
+        return str2->size() == str1->size() &&
+               !memcmp(str2->c_str(), str1->c_str(), str1->size());
+      });
+      if (existing || (buf_.is_fixed() && string_pool.full())) return;
+      string_pool.Insert(hash, base + off);
+    });
+    return Offset<T>(base + root.o);
+  }
+
   /// @brief The length of a FlatBuffer file header.
   static const size_t kFileIdentifierLength = 4;
 
@@ -1475,6 +2636,15 @@ class FlatBufferBuilder
     Finish(root.o, file_identifier, true);
   }
 
+  /// @brief Like `Finish()`, but additionally copies the buffer into a
+  /// single block if it was built using `UseSegments()`, so it can be
+  /// accessed with `GetBufferPointer()`.
+  template<typename T> void FinishContiguous(Offset<T> root,
+                                   const char *file_identifier = nullptr) {
+    Finish(root.o, file_identifier, false);
+    buf_.flatten();
+  }
+
  protected:
   // You shouldn't really be copying instances of this class.
   FlatBufferBuilder(const FlatBufferBuilder &);
@@ -1502,6 +2672,7 @@ class FlatBufferBuilder
   struct FieldLoc {
     uoffset_t off;
     voffset_t id;
+    bool is_offset;  // Whether the field holds a uoffset_t to another object.
   };
 
   vector_downward buf_;
@@ -1518,7 +2689,11 @@ class FlatBufferBuilder
   // Ensure the buffer is finished before it is being accessed.
   bool finished;
 
-  std::vector<uoffset_t> vtables_;  // todo: Could make this into a map?
+  std::vector<uoffset_t> vtables_;
+
+  // Hash index over the contents of the vtables in vtables_, used for O(1)
+  // deduplication in EndTable.
+  OffsetHashIndex vtable_index_;
 
   size_t minalign_;
 
@@ -1526,22 +2701,166 @@ class FlatBufferBuilder
 
   bool dedup_vtables_;
 
-  struct StringOffsetCompare {
-    StringOffsetCompare(const vector_downward &buf) : buf_(&buf) {}
-    bool operator() (const Offset<String> &a, const Offset<String> &b) const {
-      auto stra = reinterpret_cast<const String *>(buf_->data_at(a.o));
-      auto strb = reinterpret_cast<const String *>(buf_->data_at(b.o));
-      return strncmp(stra->c_str(), strb->c_str(),
-                     (std::min)(stra->size(), strb->size()) + 1) < 0;
-    }
-    const vector_downward *buf_;
-  };
+  // For use with CreateSharedString. Keyed on the length and contents of
+  // each string, and holds no memory until the first shared string.
+  OffsetHashIndex string_pool;
 
-  // For use with CreateSharedString. Instantiated on first use only.
-  typedef std::set<Offset<String>, StringOffsetCompare> StringOffsetMap;
-  StringOffsetMap *string_pool;
+  // For use with DedupTables and CreateSharedVector: offsets of tables and
+  // vectors, keyed on their contents, where offset fields and elements are
+  // hashed as the offset of the object they refer to.
+  bool dedup_tables_;
+  OffsetHashIndex table_pool_;
+  OffsetHashIndex vector_pool_;
+  size_t shared_bytes_saved_;
+
+  #ifdef FLATBUFFERS_BUILDER_STATS
+    BuilderStats stats_;
+  #endif
 
  private:
+  // Serializes an open-addressed hash table over `hashes` (those of the
+  // elements of a vector), as pairs of (hash, element index + 1) in a power of
+  // 2 number of slots, 0 marking an empty slot. See Vector::LookupByKey.
+  Offset<Vector<uint32_t>> BuildKeyHashIndex(
+      const std::vector<uint32_t> &hashes) {
+    auto size = static_cast<uoffset_t>(hashes.size());
+    uoffset_t slots = size ? 1 : 0;
+    while (slots < 2 * size) slots *= 2;  // At most half full.
+    std::vector<uint32_t> index(2 * slots, 0);
+    for (uoffset_t i = 0; i < size; i++) {
+      auto slot = hashes[i] & (slots - 1);
+      while (index[2 * slot + 1]) slot = (slot + 1) & (slots - 1);
+      index[2 * slot] = hashes[i];
+      index[2 * slot + 1] = i + 1;
+    }
+    return CreateVector(index);
+  }
+
+  // Copies the sorted elements of `src` to `dst` in Eytzinger order.
+  template<typename T> static void EytzingerOrder(const T *src, size_t len,
+                                                  T *dst) {
+    auto n = static_cast<uoffset_t>(len);
+    for (auto i = EytzingerFirst(n); i < n; i = EytzingerNext(i, n)) {
+      dst[i] = *src++;
+    }
+  }
+
+  // Calls f(pos, is_offset, size) for the runs of plain bytes and offset
+  // fields that make up the table at `table` (starting `start`), relative to
+  // the table. Only the fields in offsetbuf_ are considered offsets.
+  template<typename F> void ForEachTableRun(uoffset_t start, uoffset_t table,
+                                            F f) {
+    // Fields at lower offsets (from the end) come later in the table.
+    std::sort(offsetbuf_.begin(), offsetbuf_.end(),
+              [](const FieldLoc &a, const FieldLoc &b) { return a.off > b.off; });
+    uoffset_t pos = sizeof(soffset_t);  // Skip the vtable offset.
+    for (auto it = offsetbuf_.begin(); it != offsetbuf_.end(); ++it) {
+      if (!it->is_offset) continue;
+      uoffset_t field_pos = table - it->off;
+      f(pos, false, field_pos - pos);
+      f(field_pos, true, static_cast<uoffset_t>(sizeof(uoffset_t)));
+      pos = field_pos + static_cast<uoffset_t>(sizeof(uoffset_t));
+    }
+    f(pos, false, table - start - pos);
+  }
+
+  // Looks for a table identical to the one just written at `table`, using
+  // vtable `vt`. If there is one, drops the new table and returns the old one.
+  uoffset_t ShareTable(uoffset_t start, uoffset_t table, uoffset_t vt) {
+    if (IsOutOfSpace() || buf_.segment_size()) return table;
+    auto table_ptr = buf_.data_at(table);
+    auto hash = HashBytes(reinterpret_cast<const uint8_t *>(&vt), sizeof(vt));
+    ForEachTableRun(start, table, [&](uoffset_t pos, bool is_offset,
+                                      uoffset_t len) {
+      if (is_offset) {
+        // Hash the object referred to instead of the relative offset.
+        uoffset_t target = table - pos -
+                           ReadScalar<uoffset_t>(table_ptr + pos);
+        hash = HashBytes(reinterpret_cast<const uint8_t *>(&target),
+                         sizeof(target), hash);
+      } else {
+        hash = HashBytes(table_ptr + pos, len, hash);
+      }
+    });
+    auto existing = table_pool_.Find(hash, [&](uoffset_t other) {
+      auto other_ptr = buf_.data_at(other);
+      // Same vtable, and so same size and layout.
+      if (other + ReadScalar<soffset_t>(other_ptr) != vt) return false;
+      bool equal = true;
+      ForEachTableRun(start, table, [&](uoffset_t pos, bool is_offset,
+                                        uoffset_t len) {
+        if (!equal) return;
+        if (is_offset) {
+          equal = table - pos - ReadScalar<uoffset_t>(table_ptr + pos) ==
+                  other - pos - ReadScalar<uoffset_t>(other_ptr + pos);
+        } else {
+          equal = !memcmp(table_ptr + pos, other_ptr + pos, len);
+        }
+      });
+      return equal;
+    });
+    if (existing) {
+      shared_bytes_saved_ += table - start;
+      buf_.pop(GetSize() - start);
+      return existing;
+    }
+    if (!buf_.is_fixed() || !table_pool_.full()) table_pool_.Insert(hash, table);
+    return table;
+  }
+
+  // Looks for a vector identical to the one just written at `vec`, which
+  // started when the buffer was `start` bytes. If there is one, drops the new
+  // vector and returns the old one.
+  template<typename T> T ShareVector(T vec, uoffset_t start, size_t elem_size,
+                                     size_t alignment, bool offsets) {
+    if (IsOutOfSpace() || buf_.segment_size()) return vec;
+    auto vec_ptr = buf_.data_at(vec.o);
+    auto len = ReadScalar<uoffset_t>(vec_ptr);
+    auto hash = HashBytes(vec_ptr, sizeof(uoffset_t));
+    // Offset of the i-th element from the end of the buffer, minus what it
+    // refers to.
+    auto target = [](uoffset_t v, const uint8_t *p, uoffset_t i) {
+      auto elem = v - static_cast<uoffset_t>(sizeof(uoffset_t)) * (i + 1);
+      return elem - ReadScalar<uoffset_t>(p + sizeof(uoffset_t) * (i + 1));
+    };
+    if (offsets) {
+      for (uoffset_t i = 0; i < len; i++) {
+        auto t = target(vec.o, vec_ptr, i);
+        hash = HashBytes(reinterpret_cast<const uint8_t *>(&t), sizeof(t),
+                         hash);
+      }
+    } else {
+      hash = HashBytes(vec_ptr + sizeof(uoffset_t), len * elem_size, hash);
+    }
+    auto existing = vector_pool_.Find(hash, [&](uoffset_t other) {
+      auto other_ptr = buf_.data_at(other);
+      // The elements of the other vector must be aligned for this type too.
+      if (ReadScalar<uoffset_t>(other_ptr) != len ||
+          (other - sizeof(uoffset_t)) % alignment) {
+        return false;
+      }
+      if (!offsets) {
+        return !memcmp(vec_ptr + sizeof(uoffset_t),
+                       other_ptr + sizeof(uoffset_t), len * elem_size);
+      }
+      for (uoffset_t i = 0; i < len; i++) {
+        if (target(vec.o, vec_ptr, i) != target(other, other_ptr, i)) {
+          return false;
+        }
+      }
+      return true;
+    });
+    if (existing) {
+      shared_bytes_saved_ += vec.o - start;
+      buf_.pop(GetSize() - start);
+      return T(existing);
+    }
+    if (!buf_.is_fixed() || !vector_pool_.full()) {
+      vector_pool_.Insert(hash, vec.o);
+    }
+    return vec;
+  }
+
   // Allocates space for a vector of structures.
   // Must be completed with EndVectorOfStructs().
   template<typename T> T* StartVectorOfStructs(size_t vector_size) {
@@ -1579,6 +2898,8 @@ template<typename T> const T *GetSizePrefixedRoot(const void *buf) {
 /// the pointer!
 template<typename T> T *GetMutableTemporaryPointer(FlatBufferBuilder &fbb,
                                                    Offset<T> offset) {
+  // Objects may straddle segments, see FlatBufferBuilder::UseSegments().
+  assert(!fbb.IsSegmented());
   return reinterpret_cast<T *>(fbb.GetCurrentBufferPointer() +
     fbb.GetSize() - offset.o);
 }
@@ -1606,22 +2927,92 @@ inline bool BufferHasIdentifier(const void *buf, const char *identifier) {
                  identifier, FlatBufferBuilder::kFileIdentifierLength) == 0;
 }
 
+// Runs tasks, possibly in parallel, for Verifier::Parallelize().
+// flatbuffers/thread_pool.h has an implementation that uses threads.
+class Executor {
+ public:
+  class Task {
+   public:
+    virtual ~Task() {}
+    virtual void Run(size_t index) = 0;
+  };
+
+  virtual ~Executor() {}
+
+  // Calls `task.Run(i)` for all i in [0, n), from any threads, and returns
+  // when all calls have returned.
+  virtual void ParallelFor(size_t n, Task &task) = 0;
+};
+
+template<typename T> class IncrementalVerifier;
+
+#ifdef FLATBUFFERS_VERIFIER_STATS
+// Counters describing the work done by a Verifier, see Verifier::GetStats().
+// Only tracked when FLATBUFFERS_VERIFIER_STATS is defined, so they cost
+// nothing otherwise.
+struct VerifierStats {
+  // Counters per table type, see Verifier::StatsPerType().
+  struct Type {
+    // From GetFullyQualifiedName() (flatc --gen-name-strings), else nullptr.
+    const char *name;
+    size_t tables;
+    // Checked for these tables and their strings and vectors, not counting
+    // the tables they refer to.
+    size_t bytes;
+  };
+
+  VerifierStats()
+    : tables(0), vectors(0), strings(0), bytes(0), max_depth(0),
+      nanoseconds(0) {}
+
+  size_t tables;
+  size_t vectors;  // Not including strings.
+  size_t strings;
+  size_t bytes;  // In ranges checked, some (like vector sizes) twice.
+  size_t max_depth;  // Of nested tables.
+  uint64_t nanoseconds;  // Spent in VerifyBuffer() and the like.
+  std::vector<Type> types;
+};
+#endif
+
 // Helper class to verify the integrity of a FlatBuffer
 class Verifier FLATBUFFERS_FINAL_CLASS {
  public:
   Verifier(const uint8_t *buf, size_t buf_len, uoffset_t _max_depth = 64,
            uoffset_t _max_tables = 1000000)
     : buf_(buf), end_(buf + buf_len), depth_(0), max_depth_(_max_depth),
-      num_tables_(0), max_tables_(_max_tables)
+      num_tables_(0), max_tables_(_max_tables), memoize_(false),
+      executor_(nullptr), chunk_size_(0), received_(end_), incomplete_(false),
+      wanted_(0)
+    #ifdef FLATBUFFERS_VERIFIER_MAX_BYTES
+        , bytes_left_(kNoMaxBytes)
+    #endif
     #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
         , upper_bound_(buf)
     #endif
+    #ifdef FLATBUFFERS_VERIFIER_STATS
+        , stats_per_type_(false), table_bytes_(0)
+    #endif
+    #ifdef FLATBUFFERS_DEBUG_VERIFICATION_FAILURE
+        , expect_failures_(false)
+    #endif
     {}
 
+  // For callers that handle failures as part of normal operation (see
+  // LazyVerifier): don't assert on them with
+  // FLATBUFFERS_DEBUG_VERIFICATION_FAILURE.
+  void ExpectFailures(bool expect) {
+    #ifdef FLATBUFFERS_DEBUG_VERIFICATION_FAILURE
+      expect_failures_ = expect;
+    #else
+      (void)expect;
+    #endif
+  }
+
   // Central location where any verification failures register.
   bool Check(bool ok) const {
     #ifdef FLATBUFFERS_DEBUG_VERIFICATION_FAILURE
-      assert(ok);
+      assert(ok || expect_failures_);
     #endif
     #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
       if (!ok)
@@ -1637,9 +3028,17 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
       if (upper_bound_ < upper_bound)
         upper_bound_ =  upper_bound;
     #endif
-    return Check(elem_len <= (size_t) (end_ - buf_) &&
-                 elem >= buf_ &&
-                 elem <= end_ - elem_len);
+    #ifdef FLATBUFFERS_VERIFIER_STATS
+      stats_.bytes += elem_len;
+    #endif
+    #ifdef FLATBUFFERS_VERIFIER_MAX_BYTES
+      if (!CountBytes(elem_len)) return false;
+    #endif
+    // Against received_, which is end_ unless verifying incrementally.
+    return (elem_len <= (size_t) (received_ - buf_) &&
+            elem >= buf_ &&
+            elem <= received_ - elem_len) ||
+           OutOfRange(reinterpret_cast<const uint8_t *>(elem), elem_len);
   }
 
   // Verify a range indicated by sizeof(T).
@@ -1647,13 +3046,80 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
     return Verify(elem, sizeof(T));
   }
 
+  // Verifying an object that is referenced from several places (e.g. made
+  // with CreateSharedString, or a table deduplicated by the builder) normally
+  // verifies it again for every reference, which with nested sharing takes
+  // time exponential in the buffer size (bounded only by `max_tables`).
+  // With memoization on, tables and vectors of tables or strings are only
+  // verified the first time they're reached, making verification time linear
+  // in the buffer size. It costs a byte of memory per 4 bytes of buffer,
+  // allocated on first use. The depth limit is then only applied along the
+  // first path to each object.
+  void Memoize(bool memoize) { memoize_ = memoize; }
+
+  // Verify the elements of vectors of tables or strings with more than
+  // `chunk_size` elements in chunks of that size, in parallel on `executor`
+  // (which is not owned), each with its own Verifier. The result is the same
+  // as without, including the `max_tables` limit, which is shared by the
+  // chunks. Only the outermost such vectors are split.
+  // Chunks can't share the memo of Memoize(), so with memoization on,
+  // verification stays serial.
+  // Pass nullptr to verify serially again.
+  void Parallelize(Executor *executor, uoffset_t chunk_size = 4096) {
+    assert(chunk_size);
+    executor_ = executor;
+    chunk_size_ = chunk_size;
+  }
+
+  // Whether the object at `obj`, read as the type with id `type_id` (see
+  // MemoTypeId()), still needs verifying: always when memoization is off,
+  // otherwise until MarkVerified() has been called for it.
+  bool NeedsVerification(const void *obj, uint8_t type_id) const {
+    auto memo = GetMemo(obj);
+    return !memo || !type_id || *memo != type_id;
+  }
+
+  // Records that the object at `obj` verified as the type with id `type_id`.
+  // Only the first type an object is verified as is remembered, since an
+  // object verified as one type may not be valid as another. Objects that
+  // fail aren't recorded, so are checked (and fail) every time they're read.
+  void MarkVerified(const void *obj, uint8_t type_id) const {
+    auto memo = GetMemo(obj);
+    if (memo && !*memo) *memo = type_id;
+  }
+
+  // The id of vectors of strings, used by VerifyVectorOfStrings().
+  static const uint8_t kStringVectorMemoTypeId = 1;
+
+  // A small number identifying type T to NeedsVerification(), assigned on
+  // first use. Ids are shared by all verifiers, and there are only 254 of
+  // them: types that come later get 0, so objects read as them are verified
+  // every time, as without memoization. Other callers (like the reflection
+  // verifiers) may number their types themselves instead, as long as they
+  // leave out kStringVectorMemoTypeId and don't mix them with these in one
+  // verifier.
+  template<typename T> static uint8_t MemoTypeId() {
+    static const uint8_t id = NextMemoTypeId();
+    return id;
+  }
+
   // Verify a pointer (may be NULL) of a table type.
   template<typename T> bool VerifyTable(const T *table) {
-    return !table || table->Verify(*this);
+    if (!table || !NeedsVerification(table, MemoTypeId<T>())) return true;
+    auto depth = depth_;
+    if (!VerifyTableOf<T>(*this, table) &&
+        !Deferred(table, &VerifyTableOf<T>, depth)) {
+      return false;
+    }
+    MarkVerified(table, MemoTypeId<T>());
+    return true;
   }
 
   // Verify a pointer (may be NULL) of any vector type.
   template<typename T> bool Verify(const Vector<T> *vec) const {
+    #ifdef FLATBUFFERS_VERIFIER_STATS
+      if (vec) stats_.vectors++;
+    #endif
     const uint8_t *end;
     return !vec ||
            VerifyVector(reinterpret_cast<const uint8_t *>(vec), sizeof(T),
@@ -1667,6 +3133,9 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
 
   // Verify a pointer (may be NULL) to string.
   bool Verify(const String *str) const {
+    #ifdef FLATBUFFERS_VERIFIER_STATS
+      if (str) stats_.strings++;
+    #endif
     const uint8_t *end;
     return !str ||
            (VerifyVector(reinterpret_cast<const uint8_t *>(str), 1, &end) &&
@@ -1692,41 +3161,77 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
 
   // Special case for string contents, after the above has been called.
   bool VerifyVectorOfStrings(const Vector<Offset<String>> *vec) const {
-      if (vec) {
-        for (uoffset_t i = 0; i < vec->size(); i++) {
-          if (!Verify(vec->Get(i))) return false;
+      if (vec && NeedsVerification(vec, kStringVectorMemoTypeId)) {
+        if (executor_ && !memoize_ && received_ == end_ &&
+            vec->size() > chunk_size_) {
+          return VerifyChunks(vec->size(), [vec](Verifier &v, uoffset_t i) {
+            return v.Verify(vec->Get(i));
+          });
+        }
+        // Check all strings at once where possible. If that fails, the loop
+        // below finds the culprit, or the strings we haven't received yet.
+        if (!VerifyStrings(vec)) {
+          for (uoffset_t i = 0; i < vec->size(); i++) {
+            auto str = vec->Get(i);
+            if (!Verify(str) && !Defer(str, &VerifyString, depth_)) {
+              return false;
+            }
+          }
         }
+        MarkVerified(vec, kStringVectorMemoTypeId);
       }
       return true;
   }
 
   // Special case for table contents, after the above has been called.
   template<typename T> bool VerifyVectorOfTables(const Vector<Offset<T>> *vec) {
-    if (vec) {
+    auto type_id = MemoTypeId<Vector<Offset<T>>>();
+    if (vec && NeedsVerification(vec, type_id)) {
+      if (executor_ && !memoize_ && received_ == end_ &&
+          vec->size() > chunk_size_) {
+        return VerifyChunks(vec->size(), [vec](Verifier &v, uoffset_t i) {
+          return v.VerifyTable(vec->Get(i));
+        });
+      }
       for (uoffset_t i = 0; i < vec->size(); i++) {
-        if (!vec->Get(i)->Verify(*this)) return false;
+        if (!VerifyTable(vec->Get(i))) return false;
       }
+      MarkVerified(vec, type_id);
     }
     return true;
   }
 
-  template<typename T> bool VerifyBufferFromStart(const char *identifier,
-                                                  const uint8_t *start) {
-    if (identifier &&
-        (size_t(end_ - start) < 2 * sizeof(flatbuffers::uoffset_t) ||
-         !BufferHasIdentifier(start, identifier))) {
-      return false;
+  // Verify a hash index made by FlatBufferBuilder::CreateKeyHashIndex, for a
+  // vector of `vec_size` elements. Call after verifying both vectors.
+  bool VerifyKeyHashIndex(const Vector<uint32_t> *index,
+                          uoffset_t vec_size) const {
+    if (!index) return true;
+    auto slots = index->size() / 2;
+    if (!Check(index->size() % 2 == 0 && !(slots & (slots - 1))))
+      return false;  // Not pairs in a power of 2 number of slots.
+    for (uoffset_t i = 0; i < slots; i++) {
+      if (!Check(index->Get(2 * i + 1) <= vec_size)) return false;
     }
+    return true;
+  }
 
-    // Call T::Verify, which must be in the generated code for this type.
-    auto o = VerifyOffset(start);
-    return o &&
-      reinterpret_cast<const T *>(start + o)->
-        Verify(*this)
-        #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
-          && GetComputedSize()
-        #endif
-            ;
+  template<typename T> bool VerifyKeyHashIndex(const Vector<uint32_t> *index,
+                                               const Vector<T> *vec) const {
+    return VerifyKeyHashIndex(index, vec ? vec->size() : 0);
+  }
+
+  template<typename T> bool VerifyBufferFromStart(const char *identifier,
+                                                  const uint8_t *start) {
+    #ifdef FLATBUFFERS_VERIFIER_STATS
+      auto begin = std::chrono::steady_clock::now();
+      auto ok = VerifyRoot<T>(identifier, start);
+      stats_.nanoseconds += static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          std::chrono::steady_clock::now() - begin).count());
+      return ok;
+    #else
+      return VerifyRoot<T>(identifier, start);
+    #endif
   }
 
   // Verify this whole buffer, starting with root type T.
@@ -1758,6 +3263,10 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   bool VerifyComplexity() {
     depth_++;
     num_tables_++;
+    #ifdef FLATBUFFERS_VERIFIER_STATS
+      stats_.tables++;
+      if (stats_.max_depth < depth_) stats_.max_depth = depth_;
+    #endif
     return Check(depth_ <= max_depth_ && num_tables_ <= max_tables_);
   }
 
@@ -1767,6 +3276,24 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
     return true;
   }
 
+  #ifdef FLATBUFFERS_VERIFIER_MAX_BYTES
+  // Fails verification once more than `max_bytes` have been checked (the
+  // same bytes as VerifierStats::bytes), a closer bound on the time
+  // verification takes than the table limit. Only available when
+  // FLATBUFFERS_VERIFIER_MAX_BYTES is defined, since counting costs a
+  // compare per check.
+  void SetMaxBytes(size_t max_bytes) { bytes_left_ = max_bytes; }
+  #endif
+
+  #ifdef FLATBUFFERS_VERIFIER_STATS
+  // Also count tables and bytes per table type, in VerifierStats::types.
+  void StatsPerType(bool per_type) { stats_per_type_ = per_type; }
+
+  // The work done by this verifier so far, also after a failure. Only
+  // available when FLATBUFFERS_VERIFIER_STATS is defined.
+  const VerifierStats &GetStats() const { return stats_; }
+  #endif
+
   #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
   // Returns the message size in bytes
   size_t GetComputedSize() const {
@@ -1778,15 +3305,547 @@ class Verifier FLATBUFFERS_FINAL_CLASS {
   #endif
 
  private:
+  template<typename T> friend class IncrementalVerifier;
+
+  template<typename T> bool VerifyRoot(const char *identifier,
+                                       const uint8_t *start) {
+    if (identifier &&
+        (size_t(end_ - start) < 2 * sizeof(flatbuffers::uoffset_t) ||
+         !BufferHasIdentifier(start, identifier))) {
+      return false;
+    }
+
+    // Call T::Verify, which must be in the generated code for this type.
+    auto o = VerifyOffset(start);
+    return o &&
+      VerifyTableOf<T>(*this, start + o)
+        #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+          && GetComputedSize()
+        #endif
+            ;
+  }
+
+  // An object that couldn't be verified yet by IncrementalVerifier.
+  struct Pending {
+    size_t pos;     // Of the object in the buffer.
+    size_t wanted;  // Bytes needed before trying again.
+    uoffset_t depth;
+    bool (*verify)(Verifier &verifier, const void *obj);
+
+    // Orders the heap in pending_ by `wanted`, smallest first.
+    static bool After(const Pending &a, const Pending &b) {
+      return a.wanted > b.wanted;
+    }
+  };
+
+  template<typename T> static bool VerifyTableOf(Verifier &verifier,
+                                                 const void *table) {
+    #ifdef FLATBUFFERS_VERIFIER_STATS
+      if (verifier.stats_per_type_) {
+        return verifier.VerifyTableWithStats<T>(table);
+      }
+    #endif
+    return reinterpret_cast<const T *>(table)->Verify(verifier);
+  }
+
+  #ifdef FLATBUFFERS_VERIFIER_STATS
+  template<typename T> bool VerifyTableWithStats(const void *table) {
+    auto index = GetStatsType(StatsTag<T>(), GetTypeName<T>(nullptr));
+    stats_.types[index].tables++;
+    // Tables verified within this one add their bytes to table_bytes_, to
+    // be taken out of those of this one.
+    auto bytes = stats_.bytes;
+    auto outer_table_bytes = table_bytes_;
+    table_bytes_ = 0;
+    auto ok = reinterpret_cast<const T *>(table)->Verify(*this);
+    bytes = stats_.bytes - bytes;
+    stats_.types[index].bytes += bytes - table_bytes_;
+    table_bytes_ = outer_table_bytes + bytes;
+    return ok;
+  }
+
+  // A pointer unique to type T.
+  template<typename T> static const void *StatsTag() {
+    static const char tag = 0;
+    return &tag;
+  }
+
+  // The index in stats_.types of the type with tag `tag` (see StatsTag()).
+  size_t GetStatsType(const void *tag, const char *name) const {
+    for (size_t i = 0; i < stats_type_tags_.size(); i++) {
+      if (stats_type_tags_[i] == tag) return i;
+    }
+    VerifierStats::Type type = { name, 0, 0 };
+    stats_.types.push_back(type);
+    stats_type_tags_.push_back(tag);
+    return stats_.types.size() - 1;
+  }
+
+  template<typename T> static const char *GetTypeName(
+      decltype(&T::GetFullyQualifiedName)) {
+    return T::GetFullyQualifiedName();
+  }
+
+  template<typename T> static const char *GetTypeName(...) { return nullptr; }
+  #endif
+
+  static bool VerifyString(Verifier &verifier, const void *str) {
+    return verifier.Verify(reinterpret_cast<const String *>(str));
+  }
+
+  // Called by Verify() for a range past what has been received. Fails
+  // verification, of the object containing the range only until it has been
+  // received if it is within the buffer.
+  bool OutOfRange(const uint8_t *elem, size_t elem_len) const {
+    if (received_ != end_ && elem_len <= (size_t) (end_ - buf_) &&
+        elem >= buf_ && elem <= end_ - elem_len) {
+      incomplete_ = true;
+      wanted_ = static_cast<size_t>(elem + elem_len - buf_);
+      return false;
+    }
+    return Check(false);
+  }
+
+  // Called after `verify` failed on `obj`: if only for lack of bytes, queues
+  // it to run again (at `depth`) once they've been received, and returns
+  // true.
+  bool Defer(const void *obj, bool (*verify)(Verifier &verifier,
+                                             const void *obj),
+             uoffset_t depth) const {
+    if (!incomplete_) return false;
+    incomplete_ = false;
+    Pending pending = {
+      static_cast<size_t>(reinterpret_cast<const uint8_t *>(obj) - buf_),
+      wanted_, depth, verify
+    };
+    pending_.push_back(pending);
+    std::push_heap(pending_.begin(), pending_.end(), Pending::After);
+    return true;
+  }
+
+  // Runs `verify` on `obj`, deferring it if it can't be verified yet.
+  bool VerifyOrDefer(const void *obj,
+                     bool (*verify)(Verifier &verifier, const void *obj)) {
+    auto depth = depth_;
+    return verify(*this, obj) || Deferred(obj, verify, depth);
+  }
+
+  // Called after `verify` failed on `obj`, started at `depth`: defers it like
+  // Defer() does, undoing what it counted.
+  bool Deferred(const void *obj,
+                bool (*verify)(Verifier &verifier, const void *obj),
+                uoffset_t depth) {
+    if (incomplete_) {
+      // A table that got as far as VerifyTableStart() is counted again when
+      // verified later.
+      if (depth_ > depth) num_tables_--;
+      depth_ = depth;
+    }
+    return Defer(obj, verify, depth);
+  }
+
+  // Points the verifier at the buffer at `buf` (which may have moved since
+  // the last call) of `size` bytes, of which `received` have been received.
+  void Receive(const uint8_t *buf, size_t size, size_t received) {
+    #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+      upper_bound_ = buf + (upper_bound_ - buf_);
+    #endif
+    buf_ = buf;
+    end_ = buf + size;
+    received_ = buf + received;
+  }
+
+  // Verifies the pending objects that may have been received entirely now.
+  bool VerifyPending() {
+    auto received = static_cast<size_t>(received_ - buf_);
+    while (!pending_.empty() && pending_.front().wanted <= received) {
+      std::pop_heap(pending_.begin(), pending_.end(), Pending::After);
+      auto pending = pending_.back();
+      pending_.pop_back();
+      depth_ = pending.depth;
+      if (!VerifyOrDefer(buf_ + pending.pos, pending.verify)) return false;
+    }
+    return true;
+  }
+
+  // Verifies the strings of `vec` like Verify(const String *) does, but in
+  // one pass over the vector. Returns false, leaving this verifier as is, if
+  // any of them is invalid or hasn't been received in full.
+  bool VerifyStrings(const Vector<Offset<String>> *vec) const {
+    size_t last = 0;
+    uint64_t lengths = 0;
+    if (!CheckStrings(buf_, static_cast<size_t>(received_ - buf_),
+                      vec->Data(), vec->size(), &last, &lengths)) {
+      return false;
+    }
+    // The size field, the characters and the terminator of each.
+    auto bytes = 9 * static_cast<uint64_t>(vec->size()) + lengths;
+    #ifdef FLATBUFFERS_VERIFIER_MAX_BYTES
+      if (bytes > bytes_left_) return false;
+      bytes_left_ -= static_cast<size_t>(bytes);
+    #endif
+    #ifdef FLATBUFFERS_VERIFIER_STATS
+      stats_.strings += vec->size();
+      stats_.bytes += static_cast<size_t>(bytes);
+    #endif
+    #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+      if (vec->size() && upper_bound_ < buf_ + last + 1) {
+        upper_bound_ = buf_ + last + 1;
+      }
+    #endif
+    (void)last;
+    (void)lengths;
+    (void)bytes;
+    return true;
+  }
+
+  // Checks the `count` string offsets at `offsets` in the `size` bytes at
+  // `buf`. Returns the position of the last terminator in `last`, and the
+  // total length of the strings in `lengths`.
+  static bool CheckStrings(const uint8_t *buf, size_t size,
+                           const uint8_t *offsets, uoffset_t count,
+                           size_t *last, uint64_t *lengths) {
+    #ifdef FLATBUFFERS_VERIFIER_AVX2
+      static const bool avx2 = __builtin_cpu_supports("avx2") != 0;
+      if (avx2 && count >= 8 && size < FLATBUFFERS_MAX_BUFFER_SIZE) {
+        return CheckStringsAvx2(buf, size, offsets, count, last, lengths);
+      }
+    #endif
+    auto pos = static_cast<size_t>(offsets - buf);
+    size_t max_end = 0;
+    uint64_t sum = 0;
+    for (uoffset_t i = 0; i < count; i++, pos += sizeof(uoffset_t)) {
+      auto off = ReadScalar<uoffset_t>(buf + pos);
+      if (off > size - sizeof(uoffset_t) - pos) return false;
+      auto str = pos + off;
+      auto len = ReadScalar<uoffset_t>(buf + str);
+      // Leave room for the terminator.
+      if (len >= size - sizeof(uoffset_t) - str ||
+          len >= FLATBUFFERS_MAX_BUFFER_SIZE) {
+        return false;
+      }
+      auto end = str + sizeof(uoffset_t) + len;
+      if (buf[end]) return false;
+      if (max_end < end) max_end = end;
+      sum += len;
+    }
+    *last = max_end;
+    *lengths = sum;
+    return true;
+  }
+
+  #ifdef FLATBUFFERS_VERIFIER_AVX2
+  // CheckStrings() for 8 strings at a time, positions fit in 31 bits since
+  // `size` does. The remainder is left to CheckStrings().
+  __attribute__((target("avx2")))
+  static bool CheckStringsAvx2(const uint8_t *buf, size_t size,
+                               const uint8_t *offsets, uoffset_t count,
+                               size_t *last, uint64_t *lengths) {
+    auto pos = static_cast<int>(offsets - buf);
+    auto room = static_cast<int>(size - sizeof(uoffset_t));
+    auto steps = _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28);
+    auto step = _mm256_set1_epi32(32);
+    auto vroom = _mm256_set1_epi32(room);
+    // Positions of the offsets, and the room after each.
+    auto vpos = _mm256_add_epi32(_mm256_set1_epi32(pos), steps);
+    auto vafter = _mm256_sub_epi32(_mm256_set1_epi32(room - pos), steps);
+    auto ones = _mm256_set1_epi32(-1);
+    auto nonzero = _mm256_setzero_si256();
+    auto max_end = _mm256_setzero_si256();
+    auto sum = _mm256_setzero_si256();
+    uoffset_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+      auto off = _mm256_loadu_si256(
+          reinterpret_cast<const __m256i *>(offsets + i * sizeof(uoffset_t)));
+      // Unsigned off <= vafter, i.e. max(off, vafter) == vafter.
+      auto fail = _mm256_xor_si256(
+          _mm256_cmpeq_epi32(_mm256_max_epu32(off, vafter), vafter), ones);
+      if (!_mm256_testz_si256(fail, fail)) return false;
+      auto str = _mm256_add_epi32(vpos, off);
+      auto len = _mm256_i32gather_epi32(reinterpret_cast<const int *>(buf),
+                                        str, 1);
+      // Unsigned len < room - str, i.e. max(len, room - str) != len.
+      fail = _mm256_cmpeq_epi32(
+          _mm256_max_epu32(len, _mm256_sub_epi32(vroom, str)), len);
+      if (!_mm256_testz_si256(fail, fail)) return false;
+      auto end = _mm256_add_epi32(
+          _mm256_add_epi32(str, _mm256_set1_epi32(sizeof(uoffset_t))), len);
+      // The terminators, in the top byte of the 4 bytes ending at them.
+      auto term = _mm256_i32gather_epi32(
+          reinterpret_cast<const int *>(buf),
+          _mm256_sub_epi32(end, _mm256_set1_epi32(3)), 1);
+      nonzero = _mm256_or_si256(nonzero, _mm256_srli_epi32(term, 24));
+      max_end = _mm256_max_epu32(max_end, end);
+      sum = _mm256_add_epi64(
+          sum, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(len)));
+      sum = _mm256_add_epi64(
+          sum, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(len, 1)));
+      vpos = _mm256_add_epi32(vpos, step);
+      vafter = _mm256_sub_epi32(vafter, step);
+    }
+    if (!_mm256_testz_si256(nonzero, nonzero)) return false;
+    uint32_t ends[8];
+    uint64_t sums[4];
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(ends), max_end);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(sums), sum);
+    size_t rest_end = 0;
+    uint64_t rest_sum = 0;
+    if (i < count &&
+        !CheckStrings(buf, size, offsets + i * sizeof(uoffset_t), count - i,
+                      &rest_end, &rest_sum)) {
+      return false;
+    }
+    for (int k = 0; k < 8; k++) {
+      if (rest_end < ends[k]) rest_end = ends[k];
+    }
+    *last = rest_end;
+    *lengths = rest_sum + sums[0] + sums[1] + sums[2] + sums[3];
+    return true;
+  }
+  #endif
+
+  // Calls `verify(verifier, i)` for all i in [0, size), in chunks on
+  // executor_, and merges the results into this verifier.
+  template<typename F> bool VerifyChunks(uoffset_t size, F verify) const {
+    class ChunkTask : public Executor::Task {
+     public:
+      ChunkTask(const Verifier &parent, uoffset_t _size, F &_verify)
+        : size_(_size), chunk_size_(parent.chunk_size_), verify_(_verify),
+          ok_((_size - 1) / chunk_size_ + 1, 0) {
+        // The chunks get what's left of the table budget between them.
+        Verifier chunk(parent.buf_, static_cast<size_t>(parent.end_ -
+                                                        parent.buf_),
+                       parent.max_depth_,
+                       parent.max_tables_ - parent.num_tables_);
+        chunk.depth_ = parent.depth_;
+        #ifdef FLATBUFFERS_VERIFIER_MAX_BYTES
+          // And each gets all of the byte budget, checked once merged.
+          chunk.bytes_left_ = parent.bytes_left_;
+        #endif
+        #ifdef FLATBUFFERS_VERIFIER_STATS
+          chunk.stats_per_type_ = parent.stats_per_type_;
+        #endif
+        verifiers_.resize(ok_.size(), chunk);
+      }
+
+      void Run(size_t index) FLATBUFFERS_OVERRIDE {
+        auto begin = static_cast<uoffset_t>(index) * chunk_size_;
+        auto end = size_ - begin < chunk_size_ ? size_ : begin + chunk_size_;
+        for (auto i = begin; i < end; i++) {
+          if (!verify_(verifiers_[index], i)) return;
+        }
+        ok_[index] = 1;
+      }
+
+      uoffset_t size_;
+      uoffset_t chunk_size_;
+      F &verify_;
+      std::vector<char> ok_;
+      std::vector<Verifier> verifiers_;
+    };
+
+    ChunkTask task(*this, size, verify);
+    executor_->ParallelFor(task.ok_.size(), task);
+    #ifdef FLATBUFFERS_VERIFIER_MAX_BYTES
+      auto bytes_budget = bytes_left_;
+    #endif
+    for (size_t i = 0; i < task.ok_.size(); i++) {
+      if (!task.ok_[i]) return false;
+      num_tables_ += task.verifiers_[i].num_tables_;
+      #ifdef FLATBUFFERS_VERIFIER_MAX_BYTES
+        if (!CountBytes(bytes_budget - task.verifiers_[i].bytes_left_)) {
+          return false;
+        }
+      #endif
+      #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+        if (upper_bound_ < task.verifiers_[i].upper_bound_)
+          upper_bound_ = task.verifiers_[i].upper_bound_;
+      #endif
+      #ifdef FLATBUFFERS_VERIFIER_STATS
+        MergeStats(task.verifiers_[i]);
+      #endif
+    }
+    return Check(num_tables_ <= max_tables_);
+  }
+
+  #ifdef FLATBUFFERS_VERIFIER_STATS
+  // Adds the stats of a verifier of a chunk, see VerifyChunks().
+  void MergeStats(const Verifier &chunk) const {
+    auto &stats = chunk.stats_;
+    stats_.tables += stats.tables;
+    stats_.vectors += stats.vectors;
+    stats_.strings += stats.strings;
+    stats_.bytes += stats.bytes;
+    if (stats_.max_depth < stats.max_depth) stats_.max_depth = stats.max_depth;
+    for (size_t i = 0; i < stats.types.size(); i++) {
+      auto &type = stats_.types[GetStatsType(chunk.stats_type_tags_[i],
+                                             stats.types[i].name)];
+      type.tables += stats.types[i].tables;
+      type.bytes += stats.types[i].bytes;
+    }
+    table_bytes_ += chunk.table_bytes_;
+  }
+  #endif
+
+  #ifdef FLATBUFFERS_VERIFIER_MAX_BYTES
+  // The budget without SetMaxBytes(), more than can be checked.
+  static const size_t kNoMaxBytes = static_cast<size_t>(-1);
+
+  // Takes `bytes` from the budget of SetMaxBytes(), if there is enough left.
+  bool CountBytes(size_t bytes) const {
+    if (!Check(bytes <= bytes_left_)) return false;
+    bytes_left_ -= bytes;
+    return true;
+  }
+  #endif
+
+  // Hands out the ids of MemoTypeId(), from after kStringVectorMemoTypeId,
+  // then 0 once they run out.
+  static uint8_t NextMemoTypeId() {
+    static std::atomic<unsigned> next(kStringVectorMemoTypeId + 1);
+    auto id = next.fetch_add(1);
+    return id <= 255 ? static_cast<uint8_t>(id) : 0;
+  }
+
+  // The memo entry of the object at `obj`, or nullptr when not memoizing or
+  // it has none.
+  uint8_t *GetMemo(const void *obj) const {
+    if (!memoize_) return nullptr;
+    auto p = reinterpret_cast<const uint8_t *>(obj);
+    // Objects out of bounds fail verification anyway. Misaligned ones can't
+    // be represented, so are always verified.
+    if (p < buf_ || p >= end_) return nullptr;
+    auto pos = static_cast<size_t>(p - buf_);
+    if (pos % sizeof(uoffset_t)) return nullptr;
+    if (memo_.empty()) {
+      memo_.resize(static_cast<size_t>(end_ - buf_) / sizeof(uoffset_t), 0);
+    }
+    return &memo_[pos / sizeof(uoffset_t)];
+  }
+
   const uint8_t *buf_;
   const uint8_t *end_;
   uoffset_t depth_;
   uoffset_t max_depth_;
-  uoffset_t num_tables_;
+  mutable uoffset_t num_tables_;  // Updated by VerifyChunks().
   uoffset_t max_tables_;
+  bool memoize_;
+  Executor *executor_;
+  uoffset_t chunk_size_;
+  // For each uoffset_t aligned position, the type id of the object verified
+  // there, or 0.
+  mutable std::vector<uint8_t> memo_;
+  // The end of the bytes received, which is end_ unless verifying
+  // incrementally.
+  const uint8_t *received_;
+  mutable bool incomplete_;  // Set by OutOfRange().
+  mutable size_t wanted_;
+  mutable std::vector<Pending> pending_;  // A heap, see Pending::After.
+#ifdef FLATBUFFERS_VERIFIER_MAX_BYTES
+  // What is left of the budget of SetMaxBytes().
+  mutable size_t bytes_left_;
+#endif
 #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
   mutable const uint8_t *upper_bound_;
 #endif
+#ifdef FLATBUFFERS_VERIFIER_STATS
+  mutable VerifierStats stats_;
+  bool stats_per_type_;
+  mutable std::vector<const void *> stats_type_tags_;  // Of stats_.types.
+  mutable size_t table_bytes_;  // See VerifyTableWithStats().
+#endif
+#ifdef FLATBUFFERS_DEBUG_VERIFICATION_FAILURE
+  bool expect_failures_;
+#endif
+};
+
+// Verifies a size-prefixed buffer with root type T while it is still being
+// received, e.g. over a network connection. Each call to Update() verifies the
+// objects that have been received entirely, and keeps track of the others, so
+// once the last byte has arrived only those are left to verify. The result is
+// that of VerifySizePrefixedBuffer().
+// A table can only be verified once its vtable has arrived. FlatBufferBuilder
+// shares vtables by default (see DedupVtables()), keeping each with the first
+// table built with it, which ends up near the end of the buffer. So for
+// buffers built that way, most tables are left until the buffer is complete,
+// and only buffers built with DedupVtables(false) are verified early.
+//
+// Usage:
+//   IncrementalVerifier<Monster> verifier(MonsterIdentifier());
+//   while (...) {
+//     buf.insert(buf.end(), chunk, chunk + chunk_len);
+//     if (!verifier.Update(buf.data(), buf.size())) ...  // Invalid.
+//   }
+//   if (verifier.done()) ...  // Verified.
+// Objects are memoized (see Verifier::Memoize()), so that those verified
+// before the buffer was complete aren't verified again.
+template<typename T> class IncrementalVerifier {
+ public:
+  explicit IncrementalVerifier(const char *identifier = nullptr,
+                               uoffset_t max_depth = 64,
+                               uoffset_t max_tables = 1000000)
+    : verifier_(nullptr, 0, max_depth, max_tables), identifier_(identifier),
+      size_(0), started_(false), ok_(true) {
+    verifier_.Memoize(true);
+  }
+
+  // Verifies what it can of the first `received` bytes of the buffer, which
+  // may have moved since the last call, but must have kept its contents.
+  // Returns false once the buffer is known to be invalid.
+  bool Update(const uint8_t *buf, size_t received) {
+    if (!ok_) return false;
+    if (!size_) {
+      if (received < sizeof(uoffset_t)) return true;
+      auto size = ReadScalar<uoffset_t>(buf);
+      if (!verifier_.Check(size < FLATBUFFERS_MAX_BUFFER_SIZE)) {
+        return ok_ = false;
+      }
+      size_ = sizeof(uoffset_t) + size;
+    }
+    if (!verifier_.Check(received <= size_)) return ok_ = false;
+    verifier_.Receive(buf, size_, received);
+    if (!started_) {
+      // The root offset and identifier, as in VerifyBufferFromStart().
+      auto start = buf + sizeof(uoffset_t);
+      auto header = (identifier_ ? 2 : 1) * sizeof(uoffset_t);
+      if (received - sizeof(uoffset_t) < header && received < size_) {
+        return true;
+      }
+      if (identifier_ && (size_ - sizeof(uoffset_t) < header ||
+                          !BufferHasIdentifier(start, identifier_))) {
+        return ok_ = false;
+      }
+      auto o = verifier_.VerifyOffset(start);
+      if (!o) return ok_ = false;
+      started_ = true;
+      if (!verifier_.VerifyOrDefer(start + o, &Verifier::VerifyTableOf<T>)) {
+        return ok_ = false;
+      }
+    }
+    ok_ = verifier_.VerifyPending();
+    #ifdef FLATBUFFERS_TRACK_VERIFIER_BUFFER_SIZE
+      if (ok_ && done()) ok_ = verifier_.GetComputedSize() != 0;
+    #endif
+    return ok_;
+  }
+
+  // Whether the buffer has been received entirely, and is valid.
+  bool done() const {
+    return ok_ && started_ && verifier_.received_ == verifier_.end_;
+  }
+
+  // The size of the buffer (including its size prefix), once known.
+  size_t size() const { return size_; }
+
+  // The number of objects received in part, left to verify.
+  size_t pending() const { return verifier_.pending_.size(); }
+
+ private:
+  Verifier verifier_;
+  const char *identifier_;
+  size_t size_;
+  bool started_;  // Whether the root has been found.
+  bool ok_;
 };
 
 // Convenient way to bundle a buffer and its length, to pass it around
@@ -1905,12 +3964,17 @@ class Table {
   // Verify the vtable of this table.
   // Call this once per table, followed by VerifyField once per field.
   bool VerifyTableStart(Verifier &verifier) const {
+    return VerifyVTable(verifier) && verifier.VerifyComplexity();
+  }
+
+  // The checks of VerifyTableStart(), without counting the table towards the
+  // depth and table limits of the verifier.
+  bool VerifyVTable(const Verifier &verifier) const {
     // Check the vtable offset.
     if (!verifier.Verify<soffset_t>(data_)) return false;
     auto vtable = GetVTable();
     // Check the vtable size field, then check vtable fits in its entirety.
-    return verifier.VerifyComplexity() &&
-           verifier.Verify<voffset_t>(vtable) &&
+    return verifier.Verify<voffset_t>(vtable) &&
            (ReadScalar<voffset_t>(vtable) & (sizeof(voffset_t) - 1)) == 0 &&
            verifier.Verify(vtable, ReadScalar<voffset_t>(vtable));
   }
@@ -1954,6 +4018,232 @@ class Table {
   uint8_t data_[1];
 };
 
+// A table whose vtable has been looked up once, up front. Accessors of a
+// Table find the vtable (and read its size) on each call; the compiler can
+// only share that work between calls that are inlined next to each other,
+// with no calls or stores in between. Views (generated with
+// `flatc --gen-table-views`) are for code reading many fields of a table
+// with other work in between, e.g. when unpacking it.
+class TableView {
+ public:
+  explicit TableView(const void *table)
+    : data_(reinterpret_cast<const uint8_t *>(table)),
+      vtable_(data_ - ReadScalar<soffset_t>(data_)),
+      vtsize_(ReadScalar<voffset_t>(vtable_)) {}
+
+  // As in Table.
+  voffset_t GetOptionalFieldOffset(voffset_t field) const {
+    return field < vtsize_ ? ReadScalar<voffset_t>(vtable_ + field) : 0;
+  }
+
+  template<typename T> T GetField(voffset_t field, T defaultval) const {
+    auto field_offset = GetOptionalFieldOffset(field);
+    return field_offset ? ReadScalar<T>(data_ + field_offset) : defaultval;
+  }
+
+  template<typename P> P GetPointer(voffset_t field) const {
+    auto field_offset = GetOptionalFieldOffset(field);
+    auto p = data_ + field_offset;
+    return field_offset
+      ? reinterpret_cast<P>(p + ReadScalar<uoffset_t>(p))
+      : nullptr;
+  }
+
+  template<typename P> P GetStruct(voffset_t field) const {
+    auto field_offset = GetOptionalFieldOffset(field);
+    return field_offset ? reinterpret_cast<P>(data_ + field_offset) : nullptr;
+  }
+
+  bool CheckField(voffset_t field) const {
+    return GetOptionalFieldOffset(field) != 0;
+  }
+
+ private:
+  const uint8_t *data_;
+  const uint8_t *vtable_;
+  voffset_t vtsize_;
+};
+
+// Verifies a buffer a piece at a time, as it is read through the checked
+// accessors generated by flatc --gen-checked, rather than all of it up front.
+// A table is checked when reached, a field when read, and a string or vector
+// when returned, so code that reads a few fields of a large buffer only pays
+// for those, yet never reads outside the buffer. Anything that fails
+// verification reads as absent (its default value, or nullptr), and makes
+// ok() return false from then on.
+//   LazyVerifier lazy(buf, len);
+//   auto monster = GetCheckedMonster(lazy);
+//   auto hp = monster.hp();
+//   auto name = monster.name();  // nullptr if absent or invalid.
+//   if (!lazy.ok()) ...
+// Vectors of strings are only checked once, the other checks are cheaper than
+// remembering them.
+class LazyVerifier {
+ public:
+  LazyVerifier(const uint8_t *buf, size_t buf_len)
+    : verifier_(buf, buf_len), buf_(buf), buf_len_(buf_len), ok_(true) {
+    verifier_.Memoize(true);
+    // Failures only make reads come back absent, see ok().
+    verifier_.ExpectFailures(true);
+  }
+
+  // False once anything read through this verifier failed verification.
+  bool ok() const { return ok_; }
+
+  // Records the result of a check, and returns it.
+  bool Check(bool passed) {
+    ok_ = verifier_.Check(passed) && ok_;
+    return passed;
+  }
+
+  // The root table, or nullptr if the buffer doesn't have one, or doesn't
+  // start with `identifier` (when not nullptr).
+  const void *GetRoot(const char *identifier) {
+    if (!Check(!identifier || (buf_len_ >= 2 * sizeof(uoffset_t) &&
+                               BufferHasIdentifier(buf_, identifier)))) {
+      return nullptr;
+    }
+    auto o = verifier_.VerifyOffset(buf_);
+    return Check(o != 0) ? buf_ + o : nullptr;
+  }
+
+  // Returns `table` if its vtable is valid (or it is nullptr), else nullptr.
+  const Table *VerifyTable(const void *table) {
+    auto t = reinterpret_cast<const Table *>(table);
+    if (t && !Check(t->VerifyVTable(verifier_))) return nullptr;
+    return t;
+  }
+
+  bool Verify(const String *str) { return Check(verifier_.Verify(str)); }
+
+  // Vectors of scalars or structs, or just the offsets of vectors of tables.
+  template<typename T> bool Verify(const Vector<T> *vec) {
+    return Check(verifier_.Verify(vec));
+  }
+
+  bool Verify(const Vector<Offset<String>> *vec) {
+    return Check(verifier_.Verify(vec) && verifier_.VerifyVectorOfStrings(vec));
+  }
+
+  Verifier &verifier() { return verifier_; }
+
+ private:
+  Verifier verifier_;
+  const uint8_t *buf_;
+  size_t buf_len_;
+  bool ok_;
+};
+
+// A vector of tables read through a LazyVerifier, returned by the generated
+// checked accessors.
+template<typename T> class CheckedVectorOfTables {
+ public:
+  CheckedVectorOfTables(const Vector<Offset<T>> *vec, LazyVerifier *lazy)
+    : vec_(vec), lazy_(lazy) {}
+
+  // Whether the vector is present (and valid).
+  bool present() const { return vec_ != nullptr; }
+
+  uoffset_t size() const { return vec_ ? vec_->size() : 0; }
+
+  typename T::Checked Get(uoffset_t i) const {
+    assert(i < size());
+    return typename T::Checked(vec_->Get(i), lazy_);
+  }
+
+ private:
+  const Vector<Offset<T>> *vec_;
+  LazyVerifier *lazy_;
+};
+
+// Base of the X::Checked structs generated by flatc --gen-checked, that read
+// a table through a LazyVerifier.
+class CheckedTable {
+ public:
+  CheckedTable(const void *table, LazyVerifier *lazy)
+    : table_(lazy->VerifyTable(table)), lazy_(lazy) {}
+
+  // Whether the table is present (and valid).
+  bool present() const { return table_ != nullptr; }
+
+ protected:
+  template<typename T> T GetField(voffset_t field, T defaultval) const {
+    return table_ && lazy_->Check(table_->VerifyField<T>(lazy_->verifier(),
+                                                         field))
+      ? table_->GetField<T>(field, defaultval)
+      : defaultval;
+  }
+
+  template<typename P> P GetStruct(voffset_t field) const {
+    typedef typename std::remove_pointer<P>::type S;
+    return table_ && lazy_->Check(table_->VerifyField<S>(lazy_->verifier(),
+                                                         field))
+      ? table_->GetStruct<P>(field)
+      : nullptr;
+  }
+
+  // Strings, and vectors of scalars, structs or strings.
+  template<typename P> P GetPointer(voffset_t field) const {
+    if (!table_ ||
+        !lazy_->Check(table_->VerifyOffset(lazy_->verifier(), field))) {
+      return nullptr;
+    }
+    auto p = table_->GetPointer<P>(field);
+    return lazy_->Verify(p) ? p : nullptr;
+  }
+
+  template<typename T> CheckedVectorOfTables<T> GetVectorOfTables(
+      voffset_t field) const {
+    return CheckedVectorOfTables<T>(GetPointer<const Vector<Offset<T>> *>(field),
+                                    lazy_);
+  }
+
+  template<typename T> typename T::Checked GetTable(voffset_t field) const {
+    if (!table_ ||
+        !lazy_->Check(table_->VerifyOffset(lazy_->verifier(), field))) {
+      return typename T::Checked(nullptr, lazy_);
+    }
+    return typename T::Checked(table_->GetPointer<const T *>(field), lazy_);
+  }
+
+  const Table *table_;
+  LazyVerifier *lazy_;
+};
+
+// The root table of the buffer read by `lazy`, see LazyVerifier.
+template<typename T> typename T::Checked GetCheckedRoot(
+    LazyVerifier &lazy, const char *identifier = nullptr) {
+  return typename T::Checked(
+      reinterpret_cast<const T *>(lazy.GetRoot(identifier)), &lazy);
+}
+
+/// @brief Read a scalar field from every table in a vector into an array,
+/// e.g. to scan a column of values in a tight loop.
+/// Consecutive tables that share a vtable (as they typically do, see
+/// `FlatBufferBuilder::DedupVtables()`) share the lookup of the field too.
+/// @tparam T The type of the field, as stored (e.g. `uint8_t` for `bool`).
+/// @param[in] tables The vector of tables to read from.
+/// @param[in] field The vtable offset of the field, e.g. `Monster::VT_HP`.
+/// @param[in] defaultval The value of the field where it is absent.
+/// @param[out] out Room for `tables.size()` values.
+template<typename T, typename U> void GatherField(
+    const Vector<Offset<U>> &tables, voffset_t field, T defaultval, T *out) {
+  const uint8_t *vtable = nullptr;
+  voffset_t field_offset = 0;
+  auto size = tables.size();
+  for (uoffset_t i = 0; i < size; i++) {
+    auto table = reinterpret_cast<const Table *>(
+                   IndirectHelper<Offset<U>>::Read(tables.Data(), i));
+    if (table->GetVTable() != vtable) {
+      vtable = table->GetVTable();
+      field_offset = table->GetOptionalFieldOffset(field);
+    }
+    out[i] = field_offset
+      ? ReadScalar<T>(reinterpret_cast<const uint8_t *>(table) + field_offset)
+      : defaultval;
+  }
+}
+
 /// @brief This can compute the start of a FlatBuffer from a root pointer, i.e.
 /// it is the opposite transformation of GetRoot().
 /// This may be useful if you want to pass on a root and have the recipient
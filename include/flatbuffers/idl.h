@@ -262,6 +262,7 @@ struct StructDef : public Definition {
       predecl(true),
       sortbysize(true),
       has_key(false),
+      has_hash_index(false),
       minalign(1),
       bytesize(0)
     {}
@@ -281,6 +282,7 @@ struct StructDef : public Definition {
   bool predecl;     // If it's used before it was defined.
   bool sortbysize;  // Whether fields come in the declaration or size order.
   bool has_key;     // It has a key field.
+  bool has_hash_index;  // A vector of it is named by a hash_index attribute.
   size_t minalign;  // What the whole object needs to be aligned to.
   size_t bytesize;  // Size if fixed.
 
@@ -370,6 +372,11 @@ struct IDLOptions {
   bool skip_unexpected_fields_in_json;
   bool generate_name_strings;
   bool generate_object_based_api;
+  bool generate_dense_create;
+  bool generate_gather;
+  bool generate_table_views;
+  bool generate_spans;
+  bool generate_checked;
   std::string cpp_object_api_pointer_type;
   std::string cpp_object_api_string_type;
   bool gen_nullable;
@@ -427,6 +434,11 @@ struct IDLOptions {
       skip_unexpected_fields_in_json(false),
       generate_name_strings(false),
       generate_object_based_api(false),
+      generate_dense_create(false),
+      generate_gather(false),
+      generate_table_views(false),
+      generate_spans(false),
+      generate_checked(false),
       cpp_object_api_pointer_type("std::unique_ptr"),
       gen_nullable(false),
       object_suffix("T"),
@@ -513,6 +525,8 @@ class Parser : public ParserState {
     known_attributes_["deprecated"] = true;
     known_attributes_["required"] = true;
     known_attributes_["key"] = true;
+    known_attributes_["eytzinger"] = true;
+    known_attributes_["hash_index"] = true;
     known_attributes_["hash"] = true;
     known_attributes_["id"] = true;
     known_attributes_["force_align"] = true;
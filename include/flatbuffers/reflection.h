@@ -479,10 +479,234 @@ Offset<const Table *> CopyTable(FlatBufferBuilder &fbb,
 // root should point to the root type for this flatbuffer.
 // buf should point to the start of flatbuffer data.
 // length specifies the size of the flatbuffer data.
+// memoize verifies shared tables only once (see Verifier::Memoize).
 bool Verify(const reflection::Schema &schema,
             const reflection::Object &root,
             const uint8_t *buf,
-            size_t length);
+            size_t length,
+            bool memoize = false);
+
+// Verifies buffers like Verify() above, with the schema compiled once into
+// flat arrays of the checks for each table, so verifying doesn't need to read
+// the schema. Worth it when verifying many buffers with the same schema.
+// The schema isn't used after construction.
+//
+// Usage:
+//   CompiledVerifier verifier(schema, *schema.root_table());
+//   for (...) if (!verifier.Verify(buf, len)) ...
+class CompiledVerifier {
+ public:
+  CompiledVerifier(const reflection::Schema &schema,
+                   const reflection::Object &root);
+
+  // Verifies a buffer with the root type given to the constructor. May be
+  // called from several threads at once.
+  bool Verify(const uint8_t *buf, size_t length, bool memoize = false) const;
+
+ private:
+  // What to check for a field.
+  enum Kind {
+    kScalar,           // Of `size` bytes.
+    kString,
+    kStruct,           // Of `size` bytes.
+    kTable,            // Of object `child`.
+    kUnion,            // `size` types, objects in union_objects_ at `child`.
+    kVectorOfScalars,  // Of `size` bytes each.
+    kVectorOfStructs,  // Of `size` bytes each.
+    kVectorOfStrings,
+    kVectorOfTables,   // Of object `child`.
+    kUnsupported       // Vectors of unions, never valid.
+  };
+
+  struct Field {
+    voffset_t offset;
+    uint8_t kind;
+    bool required;
+    uint32_t size;
+    uint32_t child;
+  };
+
+  // The fields of an object are fields_[begin, end).
+  struct Object {
+    uint32_t begin;
+    uint32_t end;
+  };
+
+  // Marks union types that aren't in the schema.
+  static const uint32_t kNoObject = 0xFFFFFFFF;
+
+  Field CompileField(const reflection::Schema &schema,
+                     const reflection::Field &field);
+
+  bool VerifyObject(Verifier &v, uint32_t index, const Table *table,
+                    bool required) const;
+
+  std::vector<Object> objects_;  // In the order of the schema.
+  std::vector<Field> fields_;
+  std::vector<uint32_t> union_objects_;
+  uint32_t root_;
+};
+
+// The schema compiled into flat arrays, for reading buffers of schemas only
+// known at runtime at a high rate. Objects and fields are numbered densely,
+// and found by name with hash tables rather than binary searches. Reading a
+// field by its number doesn't touch the schema, which isn't used after
+// construction.
+//
+// Usage:
+//   CompiledSchema compiled(schema);
+//   auto monster = compiled.GetObjectId("MyGame.Example.Monster");
+//   auto hp = compiled.GetFieldId(monster, "hp");
+//   auto value = compiled.GetInt(*GetAnyRoot(buf), hp);
+class CompiledSchema {
+ public:
+  // Returned by the lookups for names that aren't in the schema.
+  static const uint32_t kNotFound = 0xFFFFFFFF;
+
+  struct Field {
+    voffset_t offset;  // In the vtable, or in the struct.
+    reflection::BaseType base_type;
+    reflection::BaseType element;  // Of vectors.
+    uint32_t object;   // Of tables, structs and vectors of them.
+    int64_t default_integer;  // Both set, whatever the type.
+    double default_real;
+  };
+
+  // The fields of an object are numbered [begin, end), its scalar fields
+  // first: [begin, scalars_end).
+  struct Object {
+    uint32_t begin;
+    uint32_t scalars_end;
+    uint32_t end;
+    bool is_struct;
+    uint32_t bytesize;  // Of structs.
+  };
+
+  explicit CompiledSchema(const reflection::Schema &schema);
+
+  // Objects are numbered as in the schema.
+  uint32_t num_objects() const {
+    return static_cast<uint32_t>(objects_.size());
+  }
+  uint32_t root_object() const { return root_; }  // Or kNotFound.
+  const Object &GetObject(uint32_t object) const { return objects_[object]; }
+  const Field &GetField(uint32_t field) const { return fields_[field]; }
+  const std::string &GetObjectName(uint32_t object) const {
+    return object_names_[object];
+  }
+  const std::string &GetFieldName(uint32_t field) const {
+    return field_names_[field];
+  }
+
+  // Lookups by fully qualified object name, and field name.
+  uint32_t GetObjectId(const char *name) const;
+  uint32_t GetFieldId(uint32_t object, const char *name) const;
+
+  // Any scalar field as a 64bit int or a double, like GetAnyFieldI/F, or its
+  // default converted if absent (where GetAnyFieldF returns 0 for ints).
+  int64_t GetInt(const Table &table, uint32_t field) const {
+    auto &f = fields_[field];
+    auto p = table.GetAddressOf(f.offset);
+    return p ? GetScalarI(f.base_type, p) : f.default_integer;
+  }
+  double GetFloat(const Table &table, uint32_t field) const {
+    auto &f = fields_[field];
+    auto p = table.GetAddressOf(f.offset);
+    return p ? GetScalarF(f.base_type, p) : f.default_real;
+  }
+  int64_t GetInt(const Struct &st, uint32_t field) const {
+    auto &f = fields_[field];
+    return GetScalarI(f.base_type, st.GetAddressOf(f.offset));
+  }
+  double GetFloat(const Struct &st, uint32_t field) const {
+    auto &f = fields_[field];
+    return GetScalarF(f.base_type, st.GetAddressOf(f.offset));
+  }
+
+  // A scalar field as its own type T, which is fastest.
+  template<typename T> T GetScalar(const Table &table, uint32_t field) const {
+    auto &f = fields_[field];
+    assert(IsScalar(f.base_type) && GetTypeSize(f.base_type) == sizeof(T));
+    return table.GetField<T>(f.offset, IsFloat(f.base_type)
+                                         ? static_cast<T>(f.default_real)
+                                         : static_cast<T>(f.default_integer));
+  }
+
+  // Fields that aren't scalars, nullptr if absent. For unions, the type is
+  // in the field before, and GetTable() returns the value.
+  const String *GetString(const Table &table, uint32_t field) const {
+    assert(fields_[field].base_type == reflection::String);
+    return table.GetPointer<const String *>(fields_[field].offset);
+  }
+  const Table *GetTable(const Table &table, uint32_t field) const {
+    assert(fields_[field].base_type == reflection::Union ||
+           (fields_[field].base_type == reflection::Obj &&
+            !objects_[fields_[field].object].is_struct));
+    return table.GetPointer<const Table *>(fields_[field].offset);
+  }
+  const Struct *GetStruct(const Table &table, uint32_t field) const {
+    assert(fields_[field].base_type == reflection::Obj &&
+           objects_[fields_[field].object].is_struct);
+    return table.GetStruct<const Struct *>(fields_[field].offset);
+  }
+  const VectorOfAny *GetVector(const Table &table, uint32_t field) const {
+    assert(fields_[field].base_type == reflection::Vector);
+    return table.GetPointer<const VectorOfAny *>(fields_[field].offset);
+  }
+
+  // Reads all scalar fields of `table`, of object `object`, into `row`, in
+  // the order they are numbered: row[i] is field begin + i. `row` needs
+  // room for scalars_end - begin values.
+  void GetScalars(const Table &table, uint32_t object, int64_t *row) const;
+  void GetScalars(const Table &table, uint32_t object, double *row) const;
+
+ private:
+  // GetAnyValueI/F for scalars only, which saves a call.
+  static int64_t GetScalarI(reflection::BaseType type, const uint8_t *data) {
+    switch (type) {
+      case reflection::UType:
+      case reflection::Bool:
+      case reflection::UByte:  return ReadScalar<uint8_t>(data);
+      case reflection::Byte:   return ReadScalar<int8_t>(data);
+      case reflection::Short:  return ReadScalar<int16_t>(data);
+      case reflection::UShort: return ReadScalar<uint16_t>(data);
+      case reflection::Int:    return ReadScalar<int32_t>(data);
+      case reflection::UInt:   return ReadScalar<uint32_t>(data);
+      case reflection::Long:   return ReadScalar<int64_t>(data);
+      case reflection::ULong:
+        return static_cast<int64_t>(ReadScalar<uint64_t>(data));
+      case reflection::Float:
+        return static_cast<int64_t>(ReadScalar<float>(data));
+      case reflection::Double:
+        return static_cast<int64_t>(ReadScalar<double>(data));
+      default: return GetAnyValueI(type, data);
+    }
+  }
+  static double GetScalarF(reflection::BaseType type, const uint8_t *data) {
+    switch (type) {
+      case reflection::Float:  return ReadScalar<float>(data);
+      case reflection::Double: return ReadScalar<double>(data);
+      default: return static_cast<double>(GetScalarI(type, data));
+    }
+  }
+
+  // Open addressing, kNotFound marks empty slots.
+  static uint32_t Hash(const char *name, uint32_t object) {
+    return HashBytes(reinterpret_cast<const uint8_t *>(name), strlen(name),
+                     0x811C9DC5 ^ (object * 0x9E3779B9));
+  }
+  static void Insert(std::vector<uint32_t> &index, uint32_t hash,
+                     uint32_t id);
+
+  std::vector<Object> objects_;  // In the order of the schema.
+  std::vector<Field> fields_;
+  std::vector<std::string> object_names_;
+  std::vector<std::string> field_names_;
+  std::vector<uint32_t> field_objects_;  // The object of each field.
+  std::vector<uint32_t> object_index_;   // Hash tables, sized a power of 2.
+  std::vector<uint32_t> field_index_;
+  uint32_t root_;
+};
 
 }  // namespace flatbuffers
 
@@ -29,6 +29,33 @@
   #include <cctype>
 #endif  // defined(FLATBUFFERS_CPP98_STL)
 
+// Use std::string_view (C++17) and std::span (C++20) where available,
+// otherwise the minimal replacements below. Define these to 0 to always use
+// the replacements.
+#ifndef FLATBUFFERS_HAS_STRING_VIEW
+  #if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+    #define FLATBUFFERS_HAS_STRING_VIEW 1
+  #else
+    #define FLATBUFFERS_HAS_STRING_VIEW 0
+  #endif
+#endif  // FLATBUFFERS_HAS_STRING_VIEW
+#ifndef FLATBUFFERS_HAS_SPAN
+  #if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+    #define FLATBUFFERS_HAS_SPAN 1
+  #else
+    #define FLATBUFFERS_HAS_SPAN 0
+  #endif
+#endif  // FLATBUFFERS_HAS_SPAN
+
+#if FLATBUFFERS_HAS_STRING_VIEW
+  #include <string_view>
+#else
+  #include <cstring>
+#endif  // FLATBUFFERS_HAS_STRING_VIEW
+#if FLATBUFFERS_HAS_SPAN
+  #include <span>
+#endif  // FLATBUFFERS_HAS_SPAN
+
 // This header provides backwards compatibility for C++98 STLs like stlport.
 namespace flatbuffers {
 
@@ -215,6 +242,80 @@ inline void vector_emplace_back(std::vector<T> *vector, V &&data) {
   }
 #endif  // !FLATBUFFERS_CPP98_STL
 
+#if FLATBUFFERS_HAS_STRING_VIEW
+  typedef std::string_view string_view;
+#else
+  // A read-only view of characters owned elsewhere, like std::string_view
+  // (only the commonly used parts of it).
+  class string_view {
+   public:
+    typedef const char *const_iterator;
+    typedef const char *iterator;
+
+    string_view() : data_(nullptr), size_(0) {}
+    string_view(const char *data, size_t size) : data_(data), size_(size) {}
+    string_view(const char *str) : data_(str), size_(strlen(str)) {}
+    string_view(const std::string &str)
+      : data_(str.data()), size_(str.size()) {}
+
+    const char *data() const { return data_; }
+    size_t size() const { return size_; }
+    size_t length() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const char *begin() const { return data_; }
+    const char *end() const { return data_ + size_; }
+    const char &operator[](size_t i) const { return data_[i]; }
+
+    int compare(string_view o) const {
+      auto n = size_ < o.size_ ? size_ : o.size_;
+      auto r = n ? memcmp(data_, o.data_, n) : 0;
+      if (r) return r;
+      return size_ < o.size_ ? -1 : (size_ > o.size_ ? 1 : 0);
+    }
+
+   private:
+    const char *data_;
+    size_t size_;
+  };
+
+  inline bool operator==(string_view a, string_view b) {
+    return a.compare(b) == 0;
+  }
+  inline bool operator!=(string_view a, string_view b) {
+    return a.compare(b) != 0;
+  }
+  inline bool operator<(string_view a, string_view b) {
+    return a.compare(b) < 0;
+  }
+#endif  // FLATBUFFERS_HAS_STRING_VIEW
+
+#if FLATBUFFERS_HAS_SPAN
+  template <class T> using span = std::span<T>;
+#else
+  // A view of a contiguous array owned elsewhere, like std::span (only the
+  // commonly used parts of it).
+  template <class T> class span {
+   public:
+    typedef T element_type;
+    typedef T *iterator;
+
+    span() : data_(nullptr), size_(0) {}
+    span(T *data, size_t size) : data_(data), size_(size) {}
+
+    T *data() const { return data_; }
+    size_t size() const { return size_; }
+    size_t size_bytes() const { return size_ * sizeof(T); }
+    bool empty() const { return size_ == 0; }
+    T *begin() const { return data_; }
+    T *end() const { return data_ + size_; }
+    T &operator[](size_t i) const { return data_[i]; }
+
+   private:
+    T *data_;
+    size_t size_;
+  };
+#endif  // FLATBUFFERS_HAS_SPAN
+
 }  // namespace flatbuffers
 
 #endif  // FLATBUFFERS_STL_EMULATION_H_
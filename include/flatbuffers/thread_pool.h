@@ -0,0 +1,126 @@
+/*
+ * Copyright 2017 Google Inc. All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FLATBUFFERS_THREAD_POOL_H_
+#define FLATBUFFERS_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace flatbuffers {
+
+// An Executor running tasks on a fixed set of threads, e.g. to verify large
+// buffers in parallel:
+//   ThreadPool pool;
+//   Verifier verifier(buf, len);
+//   verifier.Parallelize(&pool);
+//   bool ok = VerifyMonsterBuffer(verifier);
+// The thread calling ParallelFor() runs tasks too. Calls to ParallelFor()
+// from different threads are run one at a time.
+class ThreadPool : public Executor {
+ public:
+  // `num_threads` is the number of threads running tasks, including the
+  // caller, by default one per core.
+  explicit ThreadPool(size_t num_threads = std::thread::hardware_concurrency())
+    : task_(nullptr), num_tasks_(0), generation_(0), active_(0),
+      stop_(false), next_(0) {
+    for (size_t i = 1; i < num_threads; i++) {
+      workers_.push_back(std::thread(&ThreadPool::Work, this));
+    }
+  }
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto it = workers_.begin(); it != workers_.end(); ++it) it->join();
+  }
+
+  // The number of threads running tasks, including the caller.
+  size_t size() const { return workers_.size() + 1; }
+
+  void ParallelFor(size_t n, Task &task) FLATBUFFERS_OVERRIDE {
+    std::lock_guard<std::mutex> call_lock(call_mutex_);
+    if (workers_.empty() || n <= 1) {
+      for (size_t i = 0; i < n; i++) task.Run(i);
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      task_ = &task;
+      num_tasks_ = n;
+      next_ = 0;
+      generation_++;
+    }
+    wake_.notify_all();
+    RunTasks(task, n);
+    // All tasks have been taken, wait for the workers still running one.
+    // Clearing task_ stops workers that wake up late from joining in.
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]() { return active_ == 0; });
+    task_ = nullptr;
+  }
+
+  // These may change access mode, leave these at end of public section
+  FLATBUFFERS_DELETE_FUNC(ThreadPool(const ThreadPool &other))
+  FLATBUFFERS_DELETE_FUNC(ThreadPool &operator=(const ThreadPool &other))
+
+ private:
+  void RunTasks(Task &task, size_t n) {
+    for (size_t i = next_++; i < n; i = next_++) task.Run(i);
+  }
+
+  void Work() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    uint64_t seen = 0;
+    for (;;) {
+      wake_.wait(lock, [&]() {
+        return stop_ || (task_ && generation_ != seen);
+      });
+      if (stop_) return;
+      seen = generation_;
+      auto task = task_;
+      auto n = num_tasks_;
+      active_++;
+      lock.unlock();
+      RunTasks(*task, n);
+      lock.lock();
+      if (--active_ == 0) done_.notify_all();
+    }
+  }
+
+  std::vector<std::thread> workers_;
+  std::mutex call_mutex_;  // Held for the duration of a ParallelFor().
+  std::mutex mutex_;       // Protects the members below, except next_.
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  Task *task_;             // The running ParallelFor(), if any.
+  size_t num_tasks_;
+  uint64_t generation_;    // Incremented for every ParallelFor().
+  size_t active_;          // Workers running tasks.
+  bool stop_;
+  std::atomic<size_t> next_;  // The next task to run.
+};
+
+}  // namespace flatbuffers
+
+#endif  // FLATBUFFERS_THREAD_POOL_H_
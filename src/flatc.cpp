@@ -86,6 +86,17 @@ std::string FlatCompiler::GetUsageString(const char* program_name) const {
       "  --gen-onefile      Generate single output file for C# and Go.\n"
       "  --gen-name-strings Generate type name functions for C++.\n"
       "  --gen-object-api   Generate an additional object-based API.\n"
+      "  --gen-dense-create Generate CreateXDense functions for C++, which write\n"
+      "                     all fields of a table with a precomputed layout.\n"
+      "  --gen-gather       Generate gather_x functions for C++, which read a\n"
+      "                     scalar field from all tables in a vector at once.\n"
+      "  --gen-table-views  Generate X::View structs for C++, for reading many\n"
+      "                     fields of a table with a single vtable lookup.\n"
+      "  --gen-spans        Generate x_view() (strings) and x_span() (vectors\n"
+      "                     of scalars or structs) accessors for C++, which\n"
+      "                     point into the buffer without copying.\n"
+      "  --gen-checked      Generate X::Checked structs for C++, for reading\n"
+      "                     buffers while verifying them on access.\n"
       "  --cpp-ptr-type T   Set object API pointer type (default std::unique_ptr)\n"
       "  --cpp-str-type T   Set object API string type (default std::string)\n"
       "                     T::c_str() and T::length() must be supported\n"
@@ -205,6 +216,16 @@ int FlatCompiler::Compile(int argc, const char** argv) {
         opts.generate_name_strings = true;
       } else if(arg == "--gen-object-api") {
         opts.generate_object_based_api = true;
+      } else if(arg == "--gen-dense-create") {
+        opts.generate_dense_create = true;
+      } else if(arg == "--gen-gather") {
+        opts.generate_gather = true;
+      } else if(arg == "--gen-table-views") {
+        opts.generate_table_views = true;
+      } else if(arg == "--gen-spans") {
+        opts.generate_spans = true;
+      } else if(arg == "--gen-checked") {
+        opts.generate_checked = true;
       } else if (arg == "--cpp-ptr-type") {
         if (++argi >= argc) Error("missing type following" + arg, true);
         opts.cpp_object_api_pointer_type = argv[argi];
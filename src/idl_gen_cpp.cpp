@@ -196,6 +196,28 @@ class CppGenerator : public BaseGenerator {
       }
     }
 
+    // Generate the checked accessors, once all tables are complete, since
+    // they return the Checked structs of other tables by value.
+    if (parser_.opts.generate_checked) {
+      for (auto it = parser_.structs_.vec.begin();
+           it != parser_.structs_.vec.end(); ++it) {
+        const auto &struct_def = **it;
+        if (!struct_def.fixed && !struct_def.generated) {
+          SetNameSpace(struct_def.defined_namespace);
+          GenCheckedTable(struct_def);
+        }
+      }
+      for (auto it = parser_.structs_.vec.begin();
+           it != parser_.structs_.vec.end(); ++it) {
+        const auto &struct_def = **it;
+        if (!struct_def.fixed && !struct_def.generated &&
+            HasCheckedTableFields(struct_def)) {
+          SetNameSpace(struct_def.defined_namespace);
+          GenCheckedTablePost(struct_def);
+        }
+      }
+    }
+
     // Generate code for union verifiers.
     for (auto it = parser_.enums_.vec.begin(); it != parser_.enums_.vec.end();
          ++it) {
@@ -294,6 +316,15 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
 
+      if (parser_.opts.generate_checked) {
+        // The root of a buffer read through a flatbuffers::LazyVerifier.
+        code_ += "inline {{CPP_NAME}}::Checked GetChecked{{STRUCT_NAME}}(";
+        code_ += "    flatbuffers::LazyVerifier &lazy) {";
+        code_ += "  return flatbuffers::GetCheckedRoot<{{CPP_NAME}}>(lazy, {{ID}});";
+        code_ += "}";
+        code_ += "";
+      }
+
       if (parser_.file_extension_.length()) {
         // Return the extension
         code_ += "inline const char *{{STRUCT_NAME}}Extension() {";
@@ -1341,6 +1372,109 @@ class CppGenerator : public BaseGenerator {
     code_ += "";
   }
 
+  // Generate the hash functions for a key field, used by hash indices (see
+  // FlatBufferBuilder::CreateKeyHashIndex), only for types a hash_index
+  // attribute refers to. Expects KEY_TYPE to be set for scalar keys.
+  void GenKeyHash(const FieldDef &field) {
+    code_ += "  uint32_t KeyHash() const {";
+    if (field.value.type.base_type == BASE_TYPE_STRING) {
+      code_ += "    return flatbuffers::HashKey({{FIELD_NAME}}());";
+      code_ += "  }";
+      code_ += "  static uint32_t KeyHashWithValue(const char *val) {";
+    } else {
+      code_ += "    return KeyHashWithValue({{FIELD_NAME}}());";
+      code_ += "  }";
+      code_ += "  static uint32_t KeyHashWithValue({{KEY_TYPE}} val) {";
+    }
+    code_ += "    return flatbuffers::HashKey(val);";
+    code_ += "  }";
+  }
+
+  // Generate static gather_x functions, that read a scalar field from all
+  // tables in a vector into an array.
+  void GenGather(const StructDef &struct_def) {
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated || !IsScalar(field.value.type.base_type)) {
+        continue;
+      }
+      code_.SetValue("FIELD_NAME", Name(field));
+      code_.SetValue("FIELD_TYPE",
+                     GenTypeGet(field.value.type, "", "const ", " *", false));
+      code_.SetValue("OFFSET_NAME", GenFieldOffsetName(field));
+      code_.SetValue("DEFAULT_VALUE", GenDefaultConstant(field));
+      code_ += "  static void gather_{{FIELD_NAME}}(const flatbuffers::Vector<"
+               "flatbuffers::Offset<{{STRUCT_NAME}}>> &tables, "
+               "{{FIELD_TYPE}} *out) {";
+      code_ += "    flatbuffers::GatherField<{{FIELD_TYPE}}>(tables, "
+               "{{OFFSET_NAME}}, {{DEFAULT_VALUE}}, out);";
+      code_ += "  }";
+    }
+  }
+
+  // Generate a `field_view` accessor for a string, or a `field_span` accessor
+  // for a vector of scalars or structs, that point into the buffer.
+  void GenSpanAccessor(const FieldDef &field) {
+    const auto &type = field.value.type;
+    code_.SetValue("FIELD_NAME", Name(field));
+    if (type.base_type == BASE_TYPE_STRING) {
+      code_ += "  flatbuffers::string_view {{FIELD_NAME}}_view() const {";
+      code_ += "    auto s = {{FIELD_NAME}}();";
+      code_ += "    return s ? s->string_view() : flatbuffers::string_view();";
+      code_ += "  }";
+      return;
+    }
+    if (type.base_type != BASE_TYPE_VECTOR) return;
+    const auto elem_type = type.VectorType();
+    const bool is_struct = IsStruct(elem_type);
+    if (!is_struct && !IsScalar(elem_type.base_type)) return;
+    // Multi-byte scalars are only in their native representation on little
+    // endian machines.
+    const bool needs_le = !is_struct && SizeOf(elem_type.base_type) > 1;
+    code_.SetValue("ELEM_TYPE", is_struct
+                                    ? WrapInNameSpace(*elem_type.struct_def)
+                                    : GenTypeBasic(elem_type, false));
+    if (needs_le) code_ += "#if FLATBUFFERS_LITTLEENDIAN";
+    code_ += "  flatbuffers::span<const {{ELEM_TYPE}}> {{FIELD_NAME}}_span() "
+             "const {";
+    code_ += "    auto v = {{FIELD_NAME}}();";
+    code_ += "    return v ? flatbuffers::make_span(*v) : "
+             "flatbuffers::span<const {{ELEM_TYPE}}>();";
+    code_ += "  }";
+    if (needs_le) code_ += "#endif";
+  }
+
+  // Generate a `field_by_key` accessor for a vector of tables or structs
+  // with a key, that does `lookup` on the vector.
+  void GenLookupByKey(const FieldDef &field, const std::string &lookup) {
+    auto &elem_def = *field.value.type.struct_def;
+    const FieldDef *key_field = nullptr;
+    for (auto it = elem_def.fields.vec.begin();
+         it != elem_def.fields.vec.end(); ++it) {
+      if ((*it)->key) key_field = *it;
+    }
+    assert(key_field);  // Guaranteed by the parser.
+    std::string key_type = "const char *";
+    if (key_field->value.type.base_type != BASE_TYPE_STRING) {
+      key_type = GenTypeBasic(key_field->value.type, false) + " ";
+      if (parser_.opts.scoped_enums && key_field->value.type.enum_def) {
+        key_type = GenTypeGet(key_field->value.type, " ", "const ", " *",
+                              true);
+      }
+    }
+    code_.SetValue("KEY_TYPE", key_type);
+    code_.SetValue("ELEM_TYPE", WrapInNameSpace(elem_def));
+    code_.SetValue("VECTOR_NAME", Name(field));
+    code_.SetValue("LOOKUP", lookup);
+
+    code_ += "  const {{ELEM_TYPE}} *{{VECTOR_NAME}}_by_key("
+             "{{KEY_TYPE}}key) const {";
+    code_ += "    auto v = {{VECTOR_NAME}}();";
+    code_ += "    return v ? v->{{LOOKUP}} : nullptr;";
+    code_ += "  }";
+  }
+
   // Generate the code to call the appropriate Verify function(s) for a field.
   void GenVerifyCall(const FieldDef &field, const char* prefix) {
     code_.SetValue("PRE", prefix);
@@ -1403,6 +1537,178 @@ class CppGenerator : public BaseGenerator {
     }
   }
 
+  // The expression reading a field of a table (or table view), as returned
+  // by its accessor.
+  std::string GenFieldGetCall(const FieldDef &field) {
+    const bool is_struct = IsStruct(field.value.type);
+    const bool is_scalar = IsScalar(field.value.type.base_type);
+
+    // Call a different accessor for pointers, that indirects.
+    std::string accessor = "";
+    if (is_scalar) {
+      accessor = "GetField<";
+    } else if (is_struct) {
+      accessor = "GetStruct<";
+    } else {
+      accessor = "GetPointer<";
+    }
+    auto offset_str = GenFieldOffsetName(field);
+    auto offset_type =
+        GenTypeGet(field.value.type, "", "const ", " *", false);
+
+    auto call = accessor + offset_type + ">(" + offset_str;
+    // Default value as second arg for non-pointer types.
+    if (is_scalar) {
+      call += ", " + GenDefaultConstant(field);
+    }
+    call += ")";
+    return GenUnderlyingCast(field, true, call);
+  }
+
+  // Whether a field is a table (not a struct), or a vector of tables.
+  static bool IsTable(const Type &type) {
+    return type.base_type == BASE_TYPE_STRUCT && !type.struct_def->fixed;
+  }
+  static bool IsVectorOfTables(const Type &type) {
+    return type.base_type == BASE_TYPE_VECTOR &&
+           type.element == BASE_TYPE_STRUCT && !type.struct_def->fixed;
+  }
+
+  // Generate the Checked struct of a table, that reads it through a
+  // flatbuffers::LazyVerifier. Accessors returning the Checked struct of a
+  // table are only declared here, and defined by GenCheckedTablePost().
+  void GenCheckedTable(const StructDef &struct_def) {
+    code_.SetValue("STRUCT_NAME", Name(struct_def));
+    code_ += "struct {{STRUCT_NAME}}::Checked : public flatbuffers::CheckedTable {";
+    code_ += "  Checked(const {{STRUCT_NAME}} *table, "
+             "flatbuffers::LazyVerifier *lazy)";
+    code_ += "    : flatbuffers::CheckedTable(table, lazy) {}";
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      const auto &type = field.value.type;
+      if (field.deprecated ||
+          (type.base_type == BASE_TYPE_VECTOR &&
+           type.element == BASE_TYPE_UNION)) {
+        continue;
+      }
+      code_.SetValue("FIELD_NAME", Name(field));
+      code_.SetValue("OFFSET_NAME", GenFieldOffsetName(field));
+      if (IsTable(type)) {
+        code_.SetValue("CHILD", WrapInNameSpace(*type.struct_def));
+        code_ += "  {{CHILD}}::Checked {{FIELD_NAME}}() const;";
+      } else if (type.base_type == BASE_TYPE_UNION) {
+        auto &u = *type.enum_def;
+        for (auto u_it = u.vals.vec.begin(); u_it != u.vals.vec.end();
+             ++u_it) {
+          auto &ev = **u_it;
+          if (!IsTable(ev.union_type)) continue;
+          code_.SetValue("CHILD", GetUnionElement(ev, true, true));
+          code_.SetValue("U_FIELD_NAME", Name(field) + "_as_" + Name(ev));
+          code_ += "  {{CHILD}}::Checked {{U_FIELD_NAME}}() const;";
+        }
+      } else if (IsVectorOfTables(type)) {
+        code_.SetValue("CHILD", WrapInNameSpace(*type.struct_def));
+        code_ += "  flatbuffers::CheckedVectorOfTables<{{CHILD}}> "
+                 "{{FIELD_NAME}}() const {";
+        code_ += "    return GetVectorOfTables<{{CHILD}}>({{OFFSET_NAME}});";
+        code_ += "  }";
+      } else {
+        // The same calls as the table accessors, to the checked versions in
+        // flatbuffers::CheckedTable.
+        std::string afterptr = " *" + NullableExtension();
+        code_.SetValue("FIELD_TYPE",
+            GenTypeGet(type, " ", "const ", afterptr.c_str(), true));
+        code_.SetValue("FIELD_VALUE", GenFieldGetCall(field));
+        code_ += "  {{FIELD_TYPE}}{{FIELD_NAME}}() const {";
+        code_ += "    return {{FIELD_VALUE}};";
+        code_ += "  }";
+      }
+    }
+    code_ += "};";
+    code_ += "";
+  }
+
+  // Whether GenCheckedTablePost() has anything to generate for a table.
+  static bool HasCheckedTableFields(const StructDef &struct_def) {
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (!field.deprecated &&
+          (IsTable(field.value.type) ||
+           field.value.type.base_type == BASE_TYPE_UNION)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void GenCheckedTablePost(const StructDef &struct_def) {
+    code_.SetValue("STRUCT_NAME", Name(struct_def));
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      const auto &type = field.value.type;
+      if (field.deprecated) continue;
+      code_.SetValue("FIELD_NAME", Name(field));
+      code_.SetValue("OFFSET_NAME", GenFieldOffsetName(field));
+      if (IsTable(type)) {
+        code_.SetValue("CHILD", WrapInNameSpace(*type.struct_def));
+        code_ += "inline {{CHILD}}::Checked "
+                 "{{STRUCT_NAME}}::Checked::{{FIELD_NAME}}() const {";
+        code_ += "  return GetTable<{{CHILD}}>({{OFFSET_NAME}});";
+        code_ += "}";
+        code_ += "";
+      } else if (type.base_type == BASE_TYPE_UNION) {
+        auto &u = *type.enum_def;
+        for (auto u_it = u.vals.vec.begin(); u_it != u.vals.vec.end();
+             ++u_it) {
+          auto &ev = **u_it;
+          if (!IsTable(ev.union_type)) continue;
+          code_.SetValue("CHILD", GetUnionElement(ev, true, true));
+          code_.SetValue("U_FIELD_NAME", Name(field) + "_as_" + Name(ev));
+          code_.SetValue("U_GET_TYPE", Name(field) + UnionTypeFieldSuffix());
+          code_.SetValue("U_ELEMENT_TYPE", WrapInNameSpace(
+                         u.defined_namespace, GetEnumValUse(u, ev)));
+          code_ += "inline {{CHILD}}::Checked "
+                   "{{STRUCT_NAME}}::Checked::{{U_FIELD_NAME}}() const {";
+          code_ += "  return {{U_GET_TYPE}}() == {{U_ELEMENT_TYPE}}";
+          code_ += "      ? GetTable<{{CHILD}}>({{OFFSET_NAME}})";
+          code_ += "      : {{CHILD}}::Checked(nullptr, lazy_);";
+          code_ += "}";
+          code_ += "";
+        }
+      }
+    }
+  }
+
+  // Generate a View struct for a table, whose accessors use a vtable looked
+  // up once, when the view is created.
+  void GenTableView(const StructDef &struct_def) {
+    code_ += "  struct View : public flatbuffers::TableView {";
+    code_ += "    explicit View(const {{STRUCT_NAME}} *table)";
+    code_ += "      : flatbuffers::TableView(table) {}";
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (field.deprecated) {
+        continue;
+      }
+      std::string afterptr = " *" + NullableExtension();
+      code_.SetValue("FIELD_NAME", Name(field));
+      code_.SetValue("FIELD_TYPE",
+          GenTypeGet(field.value.type, " ", "const ", afterptr.c_str(), true));
+      code_.SetValue("FIELD_VALUE", GenFieldGetCall(field));
+      code_ += "    {{FIELD_TYPE}}{{FIELD_NAME}}() const {";
+      code_ += "      return {{FIELD_VALUE}};";
+      code_ += "    }";
+    }
+    code_ += "  };";
+    code_ += "  View view() const {";
+    code_ += "    return View(this);";
+    code_ += "  }";
+  }
+
   // Generate an accessor struct, builder structs & function for a table.
   void GenTable(const StructDef &struct_def) {
     if (parser_.opts.generate_object_based_api) {
@@ -1454,35 +1760,13 @@ class CppGenerator : public BaseGenerator {
         continue;
       }
 
-      const bool is_struct = IsStruct(field.value.type);
-      const bool is_scalar = IsScalar(field.value.type.base_type);
       code_.SetValue("FIELD_NAME", Name(field));
 
-      // Call a different accessor for pointers, that indirects.
-      std::string accessor = "";
-      if (is_scalar) {
-        accessor = "GetField<";
-      } else if (is_struct) {
-        accessor = "GetStruct<";
-      } else {
-        accessor = "GetPointer<";
-      }
-      auto offset_str = GenFieldOffsetName(field);
-      auto offset_type =
-          GenTypeGet(field.value.type, "", "const ", " *", false);
-
-      auto call = accessor + offset_type + ">(" + offset_str;
-      // Default value as second arg for non-pointer types.
-      if (is_scalar) {
-        call += ", " + GenDefaultConstant(field);
-      }
-      call += ")";
-
       std::string afterptr = " *" + NullableExtension();
       GenComment(field.doc_comment, "  ");
       code_.SetValue("FIELD_TYPE",
           GenTypeGet(field.value.type, " ", "const ", afterptr.c_str(), true));
-      code_.SetValue("FIELD_VALUE", GenUnderlyingCast(field, true, call));
+      code_.SetValue("FIELD_VALUE", GenFieldGetCall(field));
       code_.SetValue("NULLABLE_EXT", NullableExtension());
 
       code_ += "  {{FIELD_TYPE}}{{FIELD_NAME}}() const {";
@@ -1521,8 +1805,11 @@ class CppGenerator : public BaseGenerator {
         }
       }
 
+      if (parser_.opts.generate_spans) GenSpanAccessor(field);
+
       if (parser_.opts.mutable_buffer) {
-        if (is_scalar) {
+        auto offset_str = GenFieldOffsetName(field);
+        if (IsScalar(field.value.type.base_type)) {
           const auto type = GenTypeWire(field.value.type, "", false);
           code_.SetValue("SET_FN", "SetField<" + type + ">");
           code_.SetValue("OFFSET_NAME", offset_str);
@@ -1538,6 +1825,8 @@ class CppGenerator : public BaseGenerator {
         } else {
           auto postptr = " *" + NullableExtension();
           auto type = GenTypeGet(field.value.type, " ", "", postptr.c_str(), true);
+          auto accessor = IsStruct(field.value.type) ? "GetStruct<"
+                                                     : "GetPointer<";
           auto underlying = accessor + type + ">(" + offset_str + ")";
           code_.SetValue("FIELD_TYPE", type);
           code_.SetValue("FIELD_VALUE",
@@ -1565,6 +1854,17 @@ class CppGenerator : public BaseGenerator {
         code_ += "  }";
       }
 
+      if (field.attributes.Lookup("eytzinger")) {
+        GenLookupByKey(field, "LookupByKeyEytzinger(key)");
+      }
+
+      auto hash_index = field.attributes.Lookup("hash_index");
+      if (hash_index) {
+        auto indexed = struct_def.fields.Lookup(hash_index->constant);
+        assert(indexed);  // Guaranteed by the parser.
+        GenLookupByKey(*indexed, "LookupByKey(key, " + Name(field) + "())");
+      }
+
       if (field.flexbuffer) {
         code_ += "  flexbuffers::Reference {{FIELD_NAME}}_flexbuffer_root()"
                                                                      " const {";
@@ -1608,6 +1908,7 @@ class CppGenerator : public BaseGenerator {
           code_ += "    }";
           code_ += "  }";
         }
+        if (struct_def.has_hash_index) GenKeyHash(field);
       }
     }
 
@@ -1623,10 +1924,30 @@ class CppGenerator : public BaseGenerator {
       }
       GenVerifyCall(field, " &&\n           ");
     }
+    // Hash indices can only be checked once the vectors they index are.
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      auto hash_index = field.attributes.Lookup("hash_index");
+      if (field.deprecated || !hash_index) {
+        continue;
+      }
+      auto indexed = struct_def.fields.Lookup(hash_index->constant);
+      code_.SetValue("FIELD_NAME", Name(field));
+      code_.SetValue("INDEXED_NAME", Name(*indexed));
+      code_ += " &&\n           verifier.VerifyKeyHashIndex({{FIELD_NAME}}(), "
+               "{{INDEXED_NAME}}())\\";
+    }
 
     code_ += " &&\n           verifier.EndTable();";
     code_ += "  }";
 
+    if (parser_.opts.generate_gather) GenGather(struct_def);
+    if (parser_.opts.generate_table_views) GenTableView(struct_def);
+    if (parser_.opts.generate_checked) {
+      code_ += "  struct Checked;  // See flatbuffers::LazyVerifier.";
+    }
+
     if (parser_.opts.generate_object_based_api) {
       // Generate the UnPack() pre declaration.
       code_ += "  " + TableUnPackSignature(struct_def, true, parser_.opts) + ";";
@@ -1842,6 +2163,153 @@ class CppGenerator : public BaseGenerator {
       code_ += "}";
       code_ += "";
     }
+
+    if (parser_.opts.generate_dense_create) GenDenseCreate(struct_def);
+  }
+
+  // Generate a CreateXDense function, that writes all fields in a layout
+  // computed here, followed by a vtable computed here as well.
+  void GenDenseCreate(const StructDef &struct_def) {
+    // Fields are written largest alignment first, which is what the sorting
+    // in CreateX does as well, but also takes structs into account.
+    std::vector<const FieldDef *> fields;
+    size_t max_align = sizeof(soffset_t);
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      if (!(*it)->deprecated) {
+        max_align = std::max(max_align, InlineAlignment((*it)->value.type));
+      }
+    }
+    for (size_t align = max_align; align; align /= 2) {
+      for (auto it = struct_def.fields.vec.rbegin();
+           it != struct_def.fields.vec.rend(); ++it) {
+        const auto &field = **it;
+        if (!field.deprecated && InlineAlignment(field.value.type) == align) {
+          fields.push_back(&field);
+        }
+      }
+    }
+    if (fields.empty()) return;
+
+    // Lay out the table the way FlatBufferBuilder does, starting from a
+    // buffer aligned to max_align: each field is aligned to its own size,
+    // and the offset to the vtable comes last.
+    std::vector<voffset_t> vtable(2);
+    size_t size = 0;
+    std::vector<size_t> field_ends;
+    for (auto it = fields.begin(); it != fields.end(); ++it) {
+      const auto &type = (*it)->value.type;
+      size += PaddingBytes(size, InlineAlignment(type)) + InlineSize(type);
+      field_ends.push_back(size);
+    }
+    size += PaddingBytes(size, sizeof(soffset_t)) + sizeof(soffset_t);
+    for (size_t i = 0; i < fields.size(); i++) {
+      auto slot = fields[i]->value.offset / sizeof(voffset_t);
+      if (vtable.size() <= slot) vtable.resize(slot + 1, 0);
+      vtable[slot] = static_cast<voffset_t>(size - field_ends[i]);
+    }
+    vtable[0] = static_cast<voffset_t>(vtable.size() * sizeof(voffset_t));
+    vtable[1] = static_cast<voffset_t>(size);
+    std::vector<uint8_t> vtable_bytes(vtable.size() * sizeof(voffset_t));
+    for (size_t i = 0; i < vtable.size(); i++) {
+      WriteScalar(&vtable_bytes[i * sizeof(voffset_t)], vtable[i]);
+    }
+    auto hash = HashBytes(vtable_bytes.data(), vtable_bytes.size());
+
+    code_ += "// Like Create{{STRUCT_NAME}}, but writes all fields (even those "
+             "equal to";
+    code_ += "// their default) with a precomputed layout and vtable, which is "
+             "faster.";
+    code_ += "// Every argument must be passed, and all offsets and structs "
+             "must be set,";
+    code_ += "// except for union values whose type is NONE.";
+    code_ += "inline flatbuffers::Offset<{{STRUCT_NAME}}> "
+             "Create{{STRUCT_NAME}}Dense(";
+    code_ += "    flatbuffers::FlatBufferBuilder &_fbb\\";
+    bool has_union = false;
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (!field.deprecated) {
+        code_.SetValue("PARAM_NAME", Name(field));
+        code_.SetValue("PARAM_TYPE", GenTypeWire(field.value.type, " ", true));
+        code_ += ",\n    {{PARAM_TYPE}}{{PARAM_NAME}}\\";
+        has_union = has_union || field.value.type.base_type == BASE_TYPE_UNION;
+      }
+    }
+    code_ += ") {";
+    std::string vtable_values;
+    for (auto it = vtable.begin(); it != vtable.end(); ++it) {
+      if (it != vtable.begin()) vtable_values += ", ";
+      vtable_values += NumToString(*it);
+    }
+    code_.SetValue("VTABLE_VALUES", vtable_values);
+    code_.SetValue("VTABLE_HASH", NumToString(hash));
+    if (has_union) {
+      // A union value can't be left out of the layout, so when its type is
+      // NONE its slot is written anyway, and only left out of the vtable.
+      code_ += "  flatbuffers::voffset_t vtable_[] = { {{VTABLE_VALUES}} };";
+      code_ += "  uint32_t vtable_hash_ = {{VTABLE_HASH}}u;";
+    } else {
+      code_ += "  static const flatbuffers::voffset_t vtable_[] = { "
+               "{{VTABLE_VALUES}} };";
+    }
+    for (auto it = struct_def.fields.vec.begin();
+         it != struct_def.fields.vec.end(); ++it) {
+      const auto &field = **it;
+      if (!field.deprecated && !IsScalar(field.value.type.base_type)) {
+        code_.SetValue("FIELD_NAME", Name(field));
+        if (IsStruct(field.value.type)) {
+          code_ += "  assert({{FIELD_NAME}});";
+        } else if (field.value.type.base_type == BASE_TYPE_UNION) {
+          const auto &enum_def = *field.value.type.enum_def;
+          code_.SetValue("NONE",
+              GetEnumValUse(enum_def, *enum_def.vals.Lookup("NONE")));
+          code_.SetValue("SLOT", NumToString(field.value.offset /
+                                             sizeof(voffset_t)));
+          code_ += std::string("  if ({{FIELD_NAME}}") +
+                   UnionTypeFieldSuffix() + " == {{NONE}}) {";
+          code_ += "    vtable_[{{SLOT}}] = 0;";
+          code_ += "    vtable_hash_ = "
+                   "flatbuffers::FlatBufferBuilder::HashVtable(vtable_);";
+          code_ += "  } else {";
+          code_ += "    assert(!{{FIELD_NAME}}.IsNull());";
+          code_ += "  }";
+        } else {
+          code_ += "  assert(!{{FIELD_NAME}}.IsNull());";
+        }
+      }
+    }
+    code_.SetValue("ALIGN", NumToString(max_align));
+    code_ += "  _fbb.Align({{ALIGN}});";
+    code_ += "  const auto start_ = _fbb.StartTable();";
+    for (auto it = fields.begin(); it != fields.end(); ++it) {
+      const auto &field = **it;
+      code_.SetValue("FIELD_NAME", Name(field));
+      if (IsScalar(field.value.type.base_type)) {
+        code_.SetValue("FIELD_TYPE", GenTypeWire(field.value.type, "", false));
+        code_.SetValue("FIELD_VALUE", GenUnderlyingCast(field, false,
+                                                        Name(field)));
+        code_ += "  _fbb.PushElement<{{FIELD_TYPE}}>({{FIELD_VALUE}});";
+      } else if (IsStruct(field.value.type)) {
+        code_ += "  _fbb.CreateStruct(*{{FIELD_NAME}});";
+      } else if (field.value.type.base_type == BASE_TYPE_UNION) {
+        code_ += "  if ({{FIELD_NAME}}.IsNull()) "
+                 "_fbb.PushElement<flatbuffers::uoffset_t>(0);";
+        code_ += "  else _fbb.PushElement({{FIELD_NAME}});";
+      } else {
+        code_ += "  _fbb.PushElement({{FIELD_NAME}});";
+      }
+    }
+    code_ += "  return flatbuffers::Offset<{{STRUCT_NAME}}>(";
+    if (has_union) {
+      code_ += "      _fbb.EndTableWithVtable(start_, vtable_, vtable_hash_));";
+    } else {
+      code_ += "      _fbb.EndTableWithVtable(start_, vtable_, "
+               "{{VTABLE_HASH}}u));";
+    }
+    code_ += "}";
+    code_ += "";
   }
 
   std::string GenUnionUnpackVal(const FieldDef &afield,
@@ -2391,6 +2859,7 @@ class CppGenerator : public BaseGenerator {
         code_ += "    const auto key = {{FIELD_NAME}}();";
         code_ += "    return static_cast<int>(key > val) - static_cast<int>(key < val);";
         code_ += "  }";
+        if (struct_def.has_hash_index) GenKeyHash(field);
       }
     }
     code_ += "};";
@@ -676,6 +676,25 @@ CheckedError Parser::ParseField(StructDef &struct_def) {
     }
   }
 
+  // The indexed field is checked in ParseRoot.
+  auto hash_index = field->attributes.Lookup("hash_index");
+  if (hash_index) {
+    if (hash_index->type.base_type != BASE_TYPE_STRING)
+      return Error(
+            "hash_index attribute must be a string (the indexed field)");
+    if (field->value.type.base_type != BASE_TYPE_VECTOR ||
+        field->value.type.element != BASE_TYPE_UINT)
+      return Error("hash_index attribute may only apply to a vector of uint");
+  }
+
+  // Whether the elements have a key is checked in ParseRoot, since they
+  // may not have been defined yet.
+  if (field->attributes.Lookup("eytzinger") &&
+      (field->value.type.base_type != BASE_TYPE_VECTOR ||
+       field->value.type.element != BASE_TYPE_STRUCT))
+    return Error(
+          "eytzinger attribute may only apply to a vector of tables or structs");
+
   field->native_inline = field->attributes.Lookup("native_inline") != nullptr;
   if (field->native_inline && !IsStruct(field->value.type))
     return Error("native_inline can only be defined on structs'");
@@ -2186,6 +2205,31 @@ CheckedError Parser::ParseRoot(const char *source, const char **include_paths,
       }
     }
   }
+  for (auto it = structs_.vec.begin(); it != structs_.vec.end(); ++it) {
+    auto &struct_def = **it;
+    for (auto field_it = struct_def.fields.vec.begin();
+         field_it != struct_def.fields.vec.end(); ++field_it) {
+      auto &field = **field_it;
+      if (field.attributes.Lookup("eytzinger") &&
+          !field.value.type.struct_def->has_key)
+        return Error("eytzinger attribute requires the elements of " +
+                     field.name + " to have a key");
+      auto hash_index = field.attributes.Lookup("hash_index");
+      if (hash_index) {
+        auto indexed = struct_def.fields.Lookup(hash_index->constant);
+        if (!indexed || indexed->deprecated ||
+            indexed->value.type.base_type != BASE_TYPE_VECTOR ||
+            indexed->value.type.element != BASE_TYPE_STRUCT ||
+            !indexed->value.type.struct_def->has_key)
+          return Error("hash_index of " + field.name + " must name a vector "
+                       "of tables or structs with a key in the same table");
+        if (indexed->attributes.Lookup("eytzinger"))
+          return Error("hash_index can't apply to " + indexed->name +
+                       ", which is in eytzinger order");
+        indexed->value.type.struct_def->has_hash_index = true;
+      }
+    }
+  }
   return NoError();
 }
 
@@ -598,6 +598,28 @@ bool VerifyVector(flatbuffers::Verifier &v,
   return false;
 }
 
+// The id for Verifier::NeedsVerification() of the object numbered `index` in
+// the schema, or 0 when out of ids.
+static uint8_t GetMemoTypeId(uint32_t index) {
+  auto first = Verifier::kStringVectorMemoTypeId + 1;
+  return index <= 255u - first ? static_cast<uint8_t>(first + index) : 0;
+}
+
+// The same for `obj`, found by name, which the objects are sorted by.
+static uint8_t GetMemoTypeId(const reflection::Schema &schema,
+                             const reflection::Object &obj) {
+  auto objects = schema.objects();
+  uoffset_t lo = 0, hi = objects->size();
+  while (lo < hi) {
+    auto mid = lo + (hi - lo) / 2;
+    if (objects->Get(mid)->KeyCompareWithValue(obj.name()->c_str()) < 0)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return GetMemoTypeId(lo);
+}
+
 bool VerifyObject(flatbuffers::Verifier &v,
                   const reflection::Schema &schema,
                   const reflection::Object &obj,
@@ -610,6 +632,10 @@ bool VerifyObject(flatbuffers::Verifier &v,
       return false;
   }
 
+  auto type_id = GetMemoTypeId(schema, obj);
+  if (!v.NeedsVerification(table, type_id))
+    return true;
+
   if (!table->VerifyTableStart(v))
     return false;
 
@@ -702,16 +728,346 @@ bool VerifyObject(flatbuffers::Verifier &v,
 
   if (!v.EndTable())
     return false;
-  
+
+  v.MarkVerified(table, type_id);
   return true;
 }
 
 bool Verify(const reflection::Schema &schema,
             const reflection::Object &root,
             const uint8_t *buf,
-            size_t length) {
+            size_t length,
+            bool memoize) {
   Verifier v(buf, length);
+  v.Memoize(memoize);
   return VerifyObject(v, schema, root, flatbuffers::GetAnyRoot(buf), true);
 }
 
+const uint32_t CompiledVerifier::kNoObject;
+
+// The index of `obj` in the schema.
+static uint32_t GetObjectIndex(const reflection::Schema &schema,
+                               const reflection::Object *obj) {
+  for (uoffset_t i = 0; i < schema.objects()->size(); i++) {
+    if (schema.objects()->Get(i) == obj) return i;
+  }
+  assert(false);
+  return 0;
+}
+
+CompiledVerifier::CompiledVerifier(const reflection::Schema &schema,
+                                   const reflection::Object &root)
+    : root_(GetObjectIndex(schema, &root)) {
+  for (uoffset_t i = 0; i < schema.objects()->size(); i++) {
+    auto obj = schema.objects()->Get(i);
+    Object compiled = { static_cast<uint32_t>(fields_.size()), 0 };
+    if (!obj->is_struct()) {
+      for (uoffset_t j = 0; j < obj->fields()->size(); j++) {
+        fields_.push_back(CompileField(schema, *obj->fields()->Get(j)));
+      }
+    }
+    compiled.end = static_cast<uint32_t>(fields_.size());
+    objects_.push_back(compiled);
+  }
+}
+
+CompiledVerifier::Field CompiledVerifier::CompileField(
+    const reflection::Schema &schema, const reflection::Field &field) {
+  Field compiled = { field.offset(), kUnsupported, field.required(), 0, 0 };
+  auto type = field.type();
+  switch (type->base_type()) {
+    case reflection::None:
+      assert(false);
+      break;
+    case reflection::String:
+      compiled.kind = kString;
+      break;
+    case reflection::Vector:
+      switch (type->element()) {
+        case reflection::None:
+        case reflection::Vector:
+        case reflection::Union:
+          break;
+        case reflection::String:
+          compiled.kind = kVectorOfStrings;
+          break;
+        case reflection::Obj: {
+          auto obj = schema.objects()->Get(type->index());
+          if (obj->is_struct()) {
+            compiled.kind = kVectorOfStructs;
+            compiled.size = static_cast<uint32_t>(obj->bytesize());
+          } else {
+            compiled.kind = kVectorOfTables;
+            compiled.child = static_cast<uint32_t>(type->index());
+          }
+          break;
+        }
+        default:
+          compiled.kind = kVectorOfScalars;
+          compiled.size = static_cast<uint32_t>(GetTypeSize(type->element()));
+          break;
+      }
+      break;
+    case reflection::Obj: {
+      auto obj = schema.objects()->Get(type->index());
+      if (obj->is_struct()) {
+        compiled.kind = kStruct;
+        compiled.size = static_cast<uint32_t>(obj->bytesize());
+      } else {
+        compiled.kind = kTable;
+        compiled.child = static_cast<uint32_t>(type->index());
+      }
+      break;
+    }
+    case reflection::Union: {
+      // The object for each type, indexed by the type's value.
+      auto values = schema.enums()->Get(type->index())->values();
+      compiled.kind = kUnion;
+      compiled.child = static_cast<uint32_t>(union_objects_.size());
+      for (uoffset_t i = 0; i < values->size(); i++) {
+        auto value = values->Get(i);
+        if (!value->object()) continue;
+        auto utype = static_cast<uint32_t>(value->value());
+        if (utype >= compiled.size) {
+          compiled.size = utype + 1;
+          union_objects_.resize(compiled.child + compiled.size, kNoObject);
+        }
+        union_objects_[compiled.child + utype] =
+          GetObjectIndex(schema, value->object());
+      }
+      break;
+    }
+    default:
+      compiled.kind = kScalar;
+      compiled.size = static_cast<uint32_t>(GetTypeSize(type->base_type()));
+      break;
+  }
+  return compiled;
+}
+
+bool CompiledVerifier::VerifyObject(flatbuffers::Verifier &v, uint32_t index,
+                                    const flatbuffers::Table *table,
+                                    bool required) const {
+  if (!table) return !required;
+  auto &obj = objects_[index];
+  if (!v.NeedsVerification(table, GetMemoTypeId(index))) return true;
+  if (!table->VerifyTableStart(v)) return false;
+  auto data = reinterpret_cast<const uint8_t *>(table);
+  const uint8_t *end;
+  // Not &fields_[0], which is out of bounds when fields_ is empty.
+  for (auto field = fields_.data() + obj.begin,
+       last = fields_.data() + obj.end; field != last; ++field) {
+    // Everything but scalars and structs is stored as an offset, unions
+    // only need it when they have a type.
+    if (field->kind != kScalar && field->kind != kStruct &&
+        field->kind != kUnion &&
+        !table->VerifyField<uoffset_t>(v, field->offset)) {
+      return false;
+    }
+    switch (field->kind) {
+      case kScalar:
+      case kStruct: {
+        auto field_offset = table->GetOptionalFieldOffset(field->offset);
+        if (field_offset) {
+          if (!v.Verify(data + field_offset, field->size)) return false;
+        } else if (field->kind == kStruct && field->required) {
+          return false;
+        }
+        break;
+      }
+      case kString:
+        if (!v.Verify(table->GetPointer<const String *>(field->offset)))
+          return false;
+        break;
+      case kTable:
+        if (!VerifyObject(v, field->child,
+                          table->GetPointer<const Table *>(field->offset),
+                          field->required)) {
+          return false;
+        }
+        break;
+      case kUnion: {
+        // The type is the field before, which is verified as such too.
+        auto type_field =
+          static_cast<voffset_t>(field->offset - sizeof(voffset_t));
+        if (!table->VerifyField<uint8_t>(v, type_field)) return false;
+        auto utype = table->GetField<uint8_t>(type_field, 0);
+        if (utype) {
+          if (utype >= field->size ||
+              union_objects_[field->child + utype] == kNoObject ||
+              !table->VerifyField<uoffset_t>(v, field->offset) ||
+              !VerifyObject(v, union_objects_[field->child + utype],
+                            table->GetPointer<const Table *>(field->offset),
+                            field->required)) {
+            return false;
+          }
+        }
+        break;
+      }
+      case kVectorOfScalars:
+      case kVectorOfStructs: {
+        auto vec = table->GetPointer<const uint8_t *>(field->offset);
+        if (vec) {
+          if (!v.VerifyVector(vec, field->size, &end)) return false;
+        } else if (field->kind == kVectorOfStructs && field->required) {
+          return false;
+        }
+        break;
+      }
+      case kVectorOfStrings: {
+        auto vec = table->GetPointer<const Vector<Offset<String>> *>(
+          field->offset);
+        if (!v.Verify(vec) || !v.VerifyVectorOfStrings(vec)) return false;
+        break;
+      }
+      case kVectorOfTables: {
+        auto vec = table->GetPointer<const Vector<Offset<Table>> *>(
+          field->offset);
+        if (!v.Verify(vec)) return false;
+        if (vec) {
+          for (uoffset_t i = 0; i < vec->size(); i++) {
+            if (!VerifyObject(v, field->child, vec->Get(i), true)) {
+              return false;
+            }
+          }
+        }
+        break;
+      }
+      default:
+        return false;
+    }
+  }
+  if (!v.EndTable()) return false;
+  v.MarkVerified(table, GetMemoTypeId(index));
+  return true;
+}
+
+bool CompiledVerifier::Verify(const uint8_t *buf, size_t length,
+                              bool memoize) const {
+  Verifier v(buf, length);
+  v.Memoize(memoize);
+  return v.Verify<uoffset_t>(buf) &&
+         VerifyObject(v, root_, GetAnyRoot(buf), true);
+}
+
+const uint32_t CompiledSchema::kNotFound;
+
+// The smallest power of 2 that is at least twice `n`, so hash tables of that
+// size stay at most half full.
+static size_t HashTableSize(size_t n) {
+  size_t size = 2;
+  while (size < 2 * n) size *= 2;
+  return size;
+}
+
+CompiledSchema::CompiledSchema(const reflection::Schema &schema)
+    : root_(kNotFound) {
+  auto objects = schema.objects();
+  for (uoffset_t i = 0; i < objects->size(); i++) {
+    auto obj = objects->Get(i);
+    Object compiled = { static_cast<uint32_t>(fields_.size()), 0, 0,
+                        obj->is_struct(),
+                        static_cast<uint32_t>(obj->bytesize()) };
+    // Scalars first, for GetScalars().
+    for (int scalars = 1; scalars >= 0; scalars--) {
+      for (uoffset_t j = 0; j < obj->fields()->size(); j++) {
+        auto field = obj->fields()->Get(j);
+        auto type = field->type();
+        if (IsScalar(type->base_type()) != (scalars == 1)) continue;
+        Field f = { field->offset(), type->base_type(), type->element(),
+                    kNotFound, field->default_integer(),
+                    field->default_real() };
+        // The schema only has the default of the field's own kind.
+        if (IsFloat(f.base_type)) {
+          f.default_integer = static_cast<int64_t>(f.default_real);
+        } else {
+          f.default_real = static_cast<double>(f.default_integer);
+        }
+        if (type->base_type() == reflection::Obj ||
+            (type->base_type() == reflection::Vector &&
+             type->element() == reflection::Obj)) {
+          f.object = static_cast<uint32_t>(type->index());
+        }
+        fields_.push_back(f);
+        field_names_.push_back(field->name()->str());
+        field_objects_.push_back(i);
+      }
+      if (scalars) compiled.scalars_end = static_cast<uint32_t>(fields_.size());
+    }
+    compiled.end = static_cast<uint32_t>(fields_.size());
+    objects_.push_back(compiled);
+    object_names_.push_back(obj->name()->str());
+    if (obj == schema.root_table()) root_ = i;
+  }
+  object_index_.resize(HashTableSize(objects_.size()), kNotFound);
+  for (uint32_t i = 0; i < objects_.size(); i++) {
+    Insert(object_index_, Hash(object_names_[i].c_str(), kNotFound), i);
+  }
+  field_index_.resize(HashTableSize(fields_.size()), kNotFound);
+  for (uint32_t i = 0; i < fields_.size(); i++) {
+    Insert(field_index_, Hash(field_names_[i].c_str(), field_objects_[i]), i);
+  }
+}
+
+void CompiledSchema::Insert(std::vector<uint32_t> &index, uint32_t hash,
+                            uint32_t id) {
+  auto mask = index.size() - 1;
+  auto slot = hash & mask;
+  while (index[slot] != kNotFound) slot = (slot + 1) & mask;
+  index[slot] = id;
+}
+
+uint32_t CompiledSchema::GetObjectId(const char *name) const {
+  auto mask = object_index_.size() - 1;
+  for (auto slot = Hash(name, kNotFound) & mask;
+       object_index_[slot] != kNotFound; slot = (slot + 1) & mask) {
+    auto id = object_index_[slot];
+    if (object_names_[id] == name) return id;
+  }
+  return kNotFound;
+}
+
+uint32_t CompiledSchema::GetFieldId(uint32_t object, const char *name) const {
+  auto mask = field_index_.size() - 1;
+  for (auto slot = Hash(name, object) & mask;
+       field_index_[slot] != kNotFound; slot = (slot + 1) & mask) {
+    auto id = field_index_[slot];
+    if (field_objects_[id] == object && field_names_[id] == name) return id;
+  }
+  return kNotFound;
+}
+
+// Like GetInt()/GetFloat() for all scalars of a table, reading its vtable
+// only once.
+void CompiledSchema::GetScalars(const Table &table, uint32_t object,
+                                int64_t *row) const {
+  auto &obj = objects_[object];
+  assert(!obj.is_struct);
+  auto data = reinterpret_cast<const uint8_t *>(&table);
+  auto vtable = table.GetVTable();
+  auto vtsize = ReadScalar<voffset_t>(vtable);
+  for (auto i = obj.begin; i < obj.scalars_end; i++) {
+    auto &f = fields_[i];
+    auto offset = f.offset < vtsize ? ReadScalar<voffset_t>(vtable + f.offset)
+                                    : 0;
+    *row++ = offset ? GetScalarI(f.base_type, data + offset)
+                    : f.default_integer;
+  }
+}
+
+void CompiledSchema::GetScalars(const Table &table, uint32_t object,
+                                double *row) const {
+  auto &obj = objects_[object];
+  assert(!obj.is_struct);
+  auto data = reinterpret_cast<const uint8_t *>(&table);
+  auto vtable = table.GetVTable();
+  auto vtsize = ReadScalar<voffset_t>(vtable);
+  for (auto i = obj.begin; i < obj.scalars_end; i++) {
+    auto &f = fields_[i];
+    auto offset = f.offset < vtsize ? ReadScalar<voffset_t>(vtable + f.offset)
+                                    : 0;
+    *row++ = offset ? GetScalarF(f.base_type, data + offset) : f.default_real;
+  }
+}
+
 }  // namespace flatbuffers
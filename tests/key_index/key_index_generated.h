@@ -0,0 +1,627 @@
+// automatically generated by the FlatBuffers compiler, do not modify
+
+
+#ifndef FLATBUFFERS_GENERATED_KEYINDEX_KEYINDEX_H_
+#define FLATBUFFERS_GENERATED_KEYINDEX_KEYINDEX_H_
+
+#include "flatbuffers/flatbuffers.h"
+
+namespace KeyIndex {
+
+struct Point;
+
+struct Entry;
+struct EntryT;
+
+struct Plain;
+struct PlainT;
+
+struct Index;
+struct IndexT;
+
+MANUALLY_ALIGNED_STRUCT(4) Point FLATBUFFERS_FINAL_CLASS {
+ private:
+  uint32_t id_;
+  float x_;
+
+ public:
+  Point() {
+    memset(this, 0, sizeof(Point));
+  }
+  Point(const Point &_o) {
+    memcpy(this, &_o, sizeof(Point));
+  }
+  Point(uint32_t _id, float _x)
+      : id_(flatbuffers::EndianScalar(_id)),
+        x_(flatbuffers::EndianScalar(_x)) {
+  }
+  uint32_t id() const {
+    return flatbuffers::EndianScalar(id_);
+  }
+  void mutate_id(uint32_t _id) {
+    flatbuffers::WriteScalar(&id_, _id);
+  }
+  bool KeyCompareLessThan(const Point *o) const {
+    return id() < o->id();
+  }
+  int KeyCompareWithValue(uint32_t val) const {
+    const auto key = id();
+    return static_cast<int>(key > val) - static_cast<int>(key < val);
+  }
+  uint32_t KeyHash() const {
+    return KeyHashWithValue(id());
+  }
+  static uint32_t KeyHashWithValue(uint32_t val) {
+    return flatbuffers::HashKey(val);
+  }
+  float x() const {
+    return flatbuffers::EndianScalar(x_);
+  }
+  void mutate_x(float _x) {
+    flatbuffers::WriteScalar(&x_, _x);
+  }
+};
+STRUCT_END(Point, 8);
+
+struct EntryT : public flatbuffers::NativeTable {
+  typedef Entry TableType;
+  std::string name;
+  int32_t value;
+  EntryT()
+      : value(0) {
+  }
+};
+
+struct Entry FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef EntryT NativeTableType;
+  enum {
+    VT_NAME = 4,
+    VT_VALUE = 6
+  };
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  flatbuffers::String *mutable_name() {
+    return GetPointer<flatbuffers::String *>(VT_NAME);
+  }
+  bool KeyCompareLessThan(const Entry *o) const {
+    return *name() < *o->name();
+  }
+  int KeyCompareWithValue(const char *val) const {
+    return strcmp(name()->c_str(), val);
+  }
+  uint32_t KeyHash() const {
+    return flatbuffers::HashKey(name());
+  }
+  static uint32_t KeyHashWithValue(const char *val) {
+    return flatbuffers::HashKey(val);
+  }
+  int32_t value() const {
+    return GetField<int32_t>(VT_VALUE, 0);
+  }
+  bool mutate_value(int32_t _value) {
+    return SetField<int32_t>(VT_VALUE, _value, 0);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffsetRequired(verifier, VT_NAME) &&
+           verifier.Verify(name()) &&
+           VerifyField<int32_t>(verifier, VT_VALUE) &&
+           verifier.EndTable();
+  }
+  EntryT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(EntryT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Entry> Pack(flatbuffers::FlatBufferBuilder &_fbb, const EntryT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct EntryBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) {
+    fbb_.AddOffset(Entry::VT_NAME, name);
+  }
+  void add_value(int32_t value) {
+    fbb_.AddElement<int32_t>(Entry::VT_VALUE, value, 0);
+  }
+  explicit EntryBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  EntryBuilder &operator=(const EntryBuilder &);
+  flatbuffers::Offset<Entry> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Entry>(end);
+    fbb_.Required(o, Entry::VT_NAME);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Entry> CreateEntry(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> name = 0,
+    int32_t value = 0) {
+  EntryBuilder builder_(_fbb);
+  builder_.add_value(value);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Entry> CreateEntryDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const char *name = nullptr,
+    int32_t value = 0) {
+  return KeyIndex::CreateEntry(
+      _fbb,
+      name ? _fbb.CreateString(name) : 0,
+      value);
+}
+
+flatbuffers::Offset<Entry> CreateEntry(flatbuffers::FlatBufferBuilder &_fbb, const EntryT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct PlainT : public flatbuffers::NativeTable {
+  typedef Plain TableType;
+  int32_t id;
+  PlainT()
+      : id(0) {
+  }
+};
+
+struct Plain FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef PlainT NativeTableType;
+  enum {
+    VT_ID = 4
+  };
+  int32_t id() const {
+    return GetField<int32_t>(VT_ID, 0);
+  }
+  bool mutate_id(int32_t _id) {
+    return SetField<int32_t>(VT_ID, _id, 0);
+  }
+  bool KeyCompareLessThan(const Plain *o) const {
+    return id() < o->id();
+  }
+  int KeyCompareWithValue(int32_t val) const {
+    const auto key = id();
+    if (key < val) {
+      return -1;
+    } else if (key > val) {
+      return 1;
+    } else {
+      return 0;
+    }
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, VT_ID) &&
+           verifier.EndTable();
+  }
+  PlainT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(PlainT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Plain> Pack(flatbuffers::FlatBufferBuilder &_fbb, const PlainT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct PlainBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_id(int32_t id) {
+    fbb_.AddElement<int32_t>(Plain::VT_ID, id, 0);
+  }
+  explicit PlainBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  PlainBuilder &operator=(const PlainBuilder &);
+  flatbuffers::Offset<Plain> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Plain>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Plain> CreatePlain(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int32_t id = 0) {
+  PlainBuilder builder_(_fbb);
+  builder_.add_id(id);
+  return builder_.Finish();
+}
+
+flatbuffers::Offset<Plain> CreatePlain(flatbuffers::FlatBufferBuilder &_fbb, const PlainT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+struct IndexT : public flatbuffers::NativeTable {
+  typedef Index TableType;
+  std::vector<flatbuffers::unique_ptr<EntryT>> sorted;
+  std::vector<flatbuffers::unique_ptr<EntryT>> entries;
+  std::vector<uint32_t> entries_index;
+  std::vector<Point> points;
+  std::vector<uint32_t> points_index;
+  std::vector<Point> sorted_points;
+  std::vector<flatbuffers::unique_ptr<PlainT>> plain;
+  IndexT() {
+  }
+};
+
+struct Index FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  typedef IndexT NativeTableType;
+  enum {
+    VT_SORTED = 4,
+    VT_ENTRIES = 6,
+    VT_ENTRIES_INDEX = 8,
+    VT_POINTS = 10,
+    VT_POINTS_INDEX = 12,
+    VT_SORTED_POINTS = 14,
+    VT_PLAIN = 16
+  };
+  const flatbuffers::Vector<flatbuffers::Offset<Entry>> *sorted() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Entry>> *>(VT_SORTED);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<Entry>> *mutable_sorted() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Entry>> *>(VT_SORTED);
+  }
+  const Entry *sorted_by_key(const char *key) const {
+    auto v = sorted();
+    return v ? v->LookupByKeyEytzinger(key) : nullptr;
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Entry>> *entries() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Entry>> *>(VT_ENTRIES);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<Entry>> *mutable_entries() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Entry>> *>(VT_ENTRIES);
+  }
+  const flatbuffers::Vector<uint32_t> *entries_index() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_ENTRIES_INDEX);
+  }
+  flatbuffers::Vector<uint32_t> *mutable_entries_index() {
+    return GetPointer<flatbuffers::Vector<uint32_t> *>(VT_ENTRIES_INDEX);
+  }
+  const Entry *entries_by_key(const char *key) const {
+    auto v = entries();
+    return v ? v->LookupByKey(key, entries_index()) : nullptr;
+  }
+  const flatbuffers::Vector<const Point *> *points() const {
+    return GetPointer<const flatbuffers::Vector<const Point *> *>(VT_POINTS);
+  }
+  flatbuffers::Vector<const Point *> *mutable_points() {
+    return GetPointer<flatbuffers::Vector<const Point *> *>(VT_POINTS);
+  }
+  const flatbuffers::Vector<uint32_t> *points_index() const {
+    return GetPointer<const flatbuffers::Vector<uint32_t> *>(VT_POINTS_INDEX);
+  }
+  flatbuffers::Vector<uint32_t> *mutable_points_index() {
+    return GetPointer<flatbuffers::Vector<uint32_t> *>(VT_POINTS_INDEX);
+  }
+  const Point *points_by_key(uint32_t key) const {
+    auto v = points();
+    return v ? v->LookupByKey(key, points_index()) : nullptr;
+  }
+  const flatbuffers::Vector<const Point *> *sorted_points() const {
+    return GetPointer<const flatbuffers::Vector<const Point *> *>(VT_SORTED_POINTS);
+  }
+  flatbuffers::Vector<const Point *> *mutable_sorted_points() {
+    return GetPointer<flatbuffers::Vector<const Point *> *>(VT_SORTED_POINTS);
+  }
+  const Point *sorted_points_by_key(uint32_t key) const {
+    auto v = sorted_points();
+    return v ? v->LookupByKeyEytzinger(key) : nullptr;
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<Plain>> *plain() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Plain>> *>(VT_PLAIN);
+  }
+  flatbuffers::Vector<flatbuffers::Offset<Plain>> *mutable_plain() {
+    return GetPointer<flatbuffers::Vector<flatbuffers::Offset<Plain>> *>(VT_PLAIN);
+  }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyOffset(verifier, VT_SORTED) &&
+           verifier.Verify(sorted()) &&
+           verifier.VerifyVectorOfTables(sorted()) &&
+           VerifyOffset(verifier, VT_ENTRIES) &&
+           verifier.Verify(entries()) &&
+           verifier.VerifyVectorOfTables(entries()) &&
+           VerifyOffset(verifier, VT_ENTRIES_INDEX) &&
+           verifier.Verify(entries_index()) &&
+           VerifyOffset(verifier, VT_POINTS) &&
+           verifier.Verify(points()) &&
+           VerifyOffset(verifier, VT_POINTS_INDEX) &&
+           verifier.Verify(points_index()) &&
+           VerifyOffset(verifier, VT_SORTED_POINTS) &&
+           verifier.Verify(sorted_points()) &&
+           VerifyOffset(verifier, VT_PLAIN) &&
+           verifier.Verify(plain()) &&
+           verifier.VerifyVectorOfTables(plain()) &&
+           verifier.VerifyKeyHashIndex(entries_index(), entries()) &&
+           verifier.VerifyKeyHashIndex(points_index(), points()) &&
+           verifier.EndTable();
+  }
+  IndexT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  void UnPackTo(IndexT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
+  static flatbuffers::Offset<Index> Pack(flatbuffers::FlatBufferBuilder &_fbb, const IndexT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+};
+
+struct IndexBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_sorted(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Entry>>> sorted) {
+    fbb_.AddOffset(Index::VT_SORTED, sorted);
+  }
+  void add_entries(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Entry>>> entries) {
+    fbb_.AddOffset(Index::VT_ENTRIES, entries);
+  }
+  void add_entries_index(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> entries_index) {
+    fbb_.AddOffset(Index::VT_ENTRIES_INDEX, entries_index);
+  }
+  void add_points(flatbuffers::Offset<flatbuffers::Vector<const Point *>> points) {
+    fbb_.AddOffset(Index::VT_POINTS, points);
+  }
+  void add_points_index(flatbuffers::Offset<flatbuffers::Vector<uint32_t>> points_index) {
+    fbb_.AddOffset(Index::VT_POINTS_INDEX, points_index);
+  }
+  void add_sorted_points(flatbuffers::Offset<flatbuffers::Vector<const Point *>> sorted_points) {
+    fbb_.AddOffset(Index::VT_SORTED_POINTS, sorted_points);
+  }
+  void add_plain(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Plain>>> plain) {
+    fbb_.AddOffset(Index::VT_PLAIN, plain);
+  }
+  explicit IndexBuilder(flatbuffers::FlatBufferBuilder &_fbb)
+        : fbb_(_fbb) {
+    start_ = fbb_.StartTable();
+  }
+  IndexBuilder &operator=(const IndexBuilder &);
+  flatbuffers::Offset<Index> Finish() {
+    const auto end = fbb_.EndTable(start_);
+    auto o = flatbuffers::Offset<Index>(end);
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<Index> CreateIndex(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Entry>>> sorted = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Entry>>> entries = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> entries_index = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const Point *>> points = 0,
+    flatbuffers::Offset<flatbuffers::Vector<uint32_t>> points_index = 0,
+    flatbuffers::Offset<flatbuffers::Vector<const Point *>> sorted_points = 0,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Plain>>> plain = 0) {
+  IndexBuilder builder_(_fbb);
+  builder_.add_plain(plain);
+  builder_.add_sorted_points(sorted_points);
+  builder_.add_points_index(points_index);
+  builder_.add_points(points);
+  builder_.add_entries_index(entries_index);
+  builder_.add_entries(entries);
+  builder_.add_sorted(sorted);
+  return builder_.Finish();
+}
+
+inline flatbuffers::Offset<Index> CreateIndexDirect(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const std::vector<flatbuffers::Offset<Entry>> *sorted = nullptr,
+    const std::vector<flatbuffers::Offset<Entry>> *entries = nullptr,
+    const std::vector<uint32_t> *entries_index = nullptr,
+    const std::vector<const Point *> *points = nullptr,
+    const std::vector<uint32_t> *points_index = nullptr,
+    const std::vector<const Point *> *sorted_points = nullptr,
+    const std::vector<flatbuffers::Offset<Plain>> *plain = nullptr) {
+  return KeyIndex::CreateIndex(
+      _fbb,
+      sorted ? _fbb.CreateVector<flatbuffers::Offset<Entry>>(*sorted) : 0,
+      entries ? _fbb.CreateVector<flatbuffers::Offset<Entry>>(*entries) : 0,
+      entries_index ? _fbb.CreateVector<uint32_t>(*entries_index) : 0,
+      points ? _fbb.CreateVector<const Point *>(*points) : 0,
+      points_index ? _fbb.CreateVector<uint32_t>(*points_index) : 0,
+      sorted_points ? _fbb.CreateVector<const Point *>(*sorted_points) : 0,
+      plain ? _fbb.CreateVector<flatbuffers::Offset<Plain>>(*plain) : 0);
+}
+
+flatbuffers::Offset<Index> CreateIndex(flatbuffers::FlatBufferBuilder &_fbb, const IndexT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
+
+inline EntryT *Entry::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new EntryT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void Entry::UnPackTo(EntryT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = name(); if (_e) _o->name = _e->str(); };
+  { auto _e = value(); _o->value = _e; };
+}
+
+inline flatbuffers::Offset<Entry> Entry::Pack(flatbuffers::FlatBufferBuilder &_fbb, const EntryT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateEntry(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Entry> CreateEntry(flatbuffers::FlatBufferBuilder &_fbb, const EntryT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const EntryT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _name = _fbb.CreateString(_o->name);
+  auto _value = _o->value;
+  return KeyIndex::CreateEntry(
+      _fbb,
+      _name,
+      _value);
+}
+
+inline PlainT *Plain::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new PlainT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void Plain::UnPackTo(PlainT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = id(); _o->id = _e; };
+}
+
+inline flatbuffers::Offset<Plain> Plain::Pack(flatbuffers::FlatBufferBuilder &_fbb, const PlainT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreatePlain(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Plain> CreatePlain(flatbuffers::FlatBufferBuilder &_fbb, const PlainT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const PlainT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _id = _o->id;
+  return KeyIndex::CreatePlain(
+      _fbb,
+      _id);
+}
+
+inline IndexT *Index::UnPack(const flatbuffers::resolver_function_t *_resolver) const {
+  auto _o = new IndexT();
+  UnPackTo(_o, _resolver);
+  return _o;
+}
+
+inline void Index::UnPackTo(IndexT *_o, const flatbuffers::resolver_function_t *_resolver) const {
+  (void)_o;
+  (void)_resolver;
+  { auto _e = sorted(); if (_e) { _o->sorted.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->sorted[_i] = flatbuffers::unique_ptr<EntryT>(_e->Get(_i)->UnPack(_resolver)); } } };
+  { auto _e = entries(); if (_e) { _o->entries.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->entries[_i] = flatbuffers::unique_ptr<EntryT>(_e->Get(_i)->UnPack(_resolver)); } } };
+  { auto _e = entries_index(); if (_e) { _o->entries_index.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->entries_index[_i] = _e->Get(_i); } } };
+  { auto _e = points(); if (_e) { _o->points.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->points[_i] = *_e->Get(_i); } } };
+  { auto _e = points_index(); if (_e) { _o->points_index.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->points_index[_i] = _e->Get(_i); } } };
+  { auto _e = sorted_points(); if (_e) { _o->sorted_points.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->sorted_points[_i] = *_e->Get(_i); } } };
+  { auto _e = plain(); if (_e) { _o->plain.resize(_e->size()); for (flatbuffers::uoffset_t _i = 0; _i < _e->size(); _i++) { _o->plain[_i] = flatbuffers::unique_ptr<PlainT>(_e->Get(_i)->UnPack(_resolver)); } } };
+}
+
+inline flatbuffers::Offset<Index> Index::Pack(flatbuffers::FlatBufferBuilder &_fbb, const IndexT* _o, const flatbuffers::rehasher_function_t *_rehasher) {
+  return CreateIndex(_fbb, _o, _rehasher);
+}
+
+inline flatbuffers::Offset<Index> CreateIndex(flatbuffers::FlatBufferBuilder &_fbb, const IndexT *_o, const flatbuffers::rehasher_function_t *_rehasher) {
+  (void)_rehasher;
+  (void)_o;
+  struct _VectorArgs { flatbuffers::FlatBufferBuilder *__fbb; const IndexT* __o; const flatbuffers::rehasher_function_t *__rehasher; } _va = { &_fbb, _o, _rehasher}; (void)_va;
+  auto _sorted = _o->sorted.size() ? _fbb.CreateVector<flatbuffers::Offset<Entry>> (_o->sorted.size(), [](size_t i, _VectorArgs *__va) { return CreateEntry(*__va->__fbb, __va->__o->sorted[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _entries = _o->entries.size() ? _fbb.CreateVector<flatbuffers::Offset<Entry>> (_o->entries.size(), [](size_t i, _VectorArgs *__va) { return CreateEntry(*__va->__fbb, __va->__o->entries[i].get(), __va->__rehasher); }, &_va ) : 0;
+  auto _entries_index = _o->entries_index.size() ? _fbb.CreateVector(_o->entries_index) : 0;
+  auto _points = _o->points.size() ? _fbb.CreateVectorOfStructs(_o->points) : 0;
+  auto _points_index = _o->points_index.size() ? _fbb.CreateVector(_o->points_index) : 0;
+  auto _sorted_points = _o->sorted_points.size() ? _fbb.CreateVectorOfStructs(_o->sorted_points) : 0;
+  auto _plain = _o->plain.size() ? _fbb.CreateVector<flatbuffers::Offset<Plain>> (_o->plain.size(), [](size_t i, _VectorArgs *__va) { return CreatePlain(*__va->__fbb, __va->__o->plain[i].get(), __va->__rehasher); }, &_va ) : 0;
+  return KeyIndex::CreateIndex(
+      _fbb,
+      _sorted,
+      _entries,
+      _entries_index,
+      _points,
+      _points_index,
+      _sorted_points,
+      _plain);
+}
+
+inline flatbuffers::TypeTable *PointTypeTable();
+
+inline flatbuffers::TypeTable *EntryTypeTable();
+
+inline flatbuffers::TypeTable *PlainTypeTable();
+
+inline flatbuffers::TypeTable *IndexTypeTable();
+
+inline flatbuffers::TypeTable *PointTypeTable() {
+  static flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_UINT, 0, -1 },
+    { flatbuffers::ET_FLOAT, 0, -1 }
+  };
+  static const int32_t values[] = { 0, 4, 8 };
+  static const char *names[] = {
+    "id",
+    "x"
+  };
+  static flatbuffers::TypeTable tt = {
+    flatbuffers::ST_STRUCT, 2, type_codes, nullptr, values, names
+  };
+  return &tt;
+}
+
+inline flatbuffers::TypeTable *EntryTypeTable() {
+  static flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_STRING, 0, -1 },
+    { flatbuffers::ET_INT, 0, -1 }
+  };
+  static const char *names[] = {
+    "name",
+    "value"
+  };
+  static flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 2, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline flatbuffers::TypeTable *PlainTypeTable() {
+  static flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_INT, 0, -1 }
+  };
+  static const char *names[] = {
+    "id"
+  };
+  static flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 1, type_codes, nullptr, nullptr, names
+  };
+  return &tt;
+}
+
+inline flatbuffers::TypeTable *IndexTypeTable() {
+  static flatbuffers::TypeCode type_codes[] = {
+    { flatbuffers::ET_SEQUENCE, 1, 0 },
+    { flatbuffers::ET_SEQUENCE, 1, 0 },
+    { flatbuffers::ET_UINT, 1, -1 },
+    { flatbuffers::ET_SEQUENCE, 1, 1 },
+    { flatbuffers::ET_UINT, 1, -1 },
+    { flatbuffers::ET_SEQUENCE, 1, 1 },
+    { flatbuffers::ET_SEQUENCE, 1, 2 }
+  };
+  static flatbuffers::TypeFunction type_refs[] = {
+    EntryTypeTable,
+    PointTypeTable,
+    PlainTypeTable
+  };
+  static const char *names[] = {
+    "sorted",
+    "entries",
+    "entries_index",
+    "points",
+    "points_index",
+    "sorted_points",
+    "plain"
+  };
+  static flatbuffers::TypeTable tt = {
+    flatbuffers::ST_TABLE, 7, type_codes, type_refs, nullptr, names
+  };
+  return &tt;
+}
+
+inline const KeyIndex::Index *GetIndex(const void *buf) {
+  return flatbuffers::GetRoot<KeyIndex::Index>(buf);
+}
+
+inline Index *GetMutableIndex(void *buf) {
+  return flatbuffers::GetMutableRoot<Index>(buf);
+}
+
+inline bool VerifyIndexBuffer(
+    flatbuffers::Verifier &verifier) {
+  return verifier.VerifyBuffer<KeyIndex::Index>(nullptr);
+}
+
+inline void FinishIndexBuffer(
+    flatbuffers::FlatBufferBuilder &fbb,
+    flatbuffers::Offset<KeyIndex::Index> root) {
+  fbb.Finish(root);
+}
+
+inline flatbuffers::unique_ptr<IndexT> UnPackIndex(
+    const void *buf,
+    const flatbuffers::resolver_function_t *res = nullptr) {
+  return flatbuffers::unique_ptr<IndexT>(GetIndex(buf)->UnPack(res));
+}
+
+}  // namespace KeyIndex
+
+#endif  // FLATBUFFERS_GENERATED_KEYINDEX_KEYINDEX_H_
@@ -194,6 +194,9 @@ MANUALLY_ALIGNED_STRUCT(2) Test FLATBUFFERS_FINAL_CLASS {
   int8_t padding0__;
 
  public:
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.Example.Test";
+  }
   Test() {
     memset(this, 0, sizeof(Test));
   }
@@ -234,6 +237,9 @@ MANUALLY_ALIGNED_STRUCT(16) Vec3 FLATBUFFERS_FINAL_CLASS {
   int16_t padding2__;
 
  public:
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.Example.Vec3";
+  }
   Vec3() {
     memset(this, 0, sizeof(Vec3));
   }
@@ -299,6 +305,9 @@ MANUALLY_ALIGNED_STRUCT(4) Ability FLATBUFFERS_FINAL_CLASS {
   uint32_t distance_;
 
  public:
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.Example.Ability";
+  }
   Ability() {
     memset(this, 0, sizeof(Ability));
   }
@@ -335,16 +344,30 @@ STRUCT_END(Ability, 8);
 
 struct InParentNamespaceT : public flatbuffers::NativeTable {
   typedef InParentNamespace TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.InParentNamespaceT";
+  }
   InParentNamespaceT() {
   }
 };
 
 struct InParentNamespace FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef InParentNamespaceT NativeTableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.InParentNamespace";
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            verifier.EndTable();
   }
+  struct View : public flatbuffers::TableView {
+    explicit View(const InParentNamespace *table)
+      : flatbuffers::TableView(table) {}
+  };
+  View view() const {
+    return View(this);
+  }
+  struct Checked;  // See flatbuffers::LazyVerifier.
   InParentNamespaceT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(InParentNamespaceT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<InParentNamespace> Pack(flatbuffers::FlatBufferBuilder &_fbb, const InParentNamespaceT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -377,16 +400,30 @@ namespace Example2 {
 
 struct MonsterT : public flatbuffers::NativeTable {
   typedef Monster TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.Example2.MonsterT";
+  }
   MonsterT() {
   }
 };
 
 struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef MonsterT NativeTableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.Example2.Monster";
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            verifier.EndTable();
   }
+  struct View : public flatbuffers::TableView {
+    explicit View(const Monster *table)
+      : flatbuffers::TableView(table) {}
+  };
+  View view() const {
+    return View(this);
+  }
+  struct Checked;  // See flatbuffers::LazyVerifier.
   MonsterT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -421,6 +458,9 @@ namespace Example {
 
 struct TestSimpleTableWithEnumT : public flatbuffers::NativeTable {
   typedef TestSimpleTableWithEnum TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.Example.TestSimpleTableWithEnumT";
+  }
   Color color;
   TestSimpleTableWithEnumT()
       : color(Color_Green) {
@@ -429,6 +469,9 @@ struct TestSimpleTableWithEnumT : public flatbuffers::NativeTable {
 
 struct TestSimpleTableWithEnum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef TestSimpleTableWithEnumT NativeTableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.Example.TestSimpleTableWithEnum";
+  }
   enum {
     VT_COLOR = 4
   };
@@ -443,6 +486,20 @@ struct TestSimpleTableWithEnum FLATBUFFERS_FINAL_CLASS : private flatbuffers::Ta
            VerifyField<int8_t>(verifier, VT_COLOR) &&
            verifier.EndTable();
   }
+  static void gather_color(const flatbuffers::Vector<flatbuffers::Offset<TestSimpleTableWithEnum>> &tables, int8_t *out) {
+    flatbuffers::GatherField<int8_t>(tables, VT_COLOR, 2, out);
+  }
+  struct View : public flatbuffers::TableView {
+    explicit View(const TestSimpleTableWithEnum *table)
+      : flatbuffers::TableView(table) {}
+    Color color() const {
+      return static_cast<Color>(GetField<int8_t>(VT_COLOR, 2));
+    }
+  };
+  View view() const {
+    return View(this);
+  }
+  struct Checked;  // See flatbuffers::LazyVerifier.
   TestSimpleTableWithEnumT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(TestSimpleTableWithEnumT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<TestSimpleTableWithEnum> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -474,10 +531,28 @@ inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnu
   return builder_.Finish();
 }
 
+// Like CreateTestSimpleTableWithEnum, but writes all fields (even those equal to
+// their default) with a precomputed layout and vtable, which is faster.
+// Every argument must be passed, and all offsets and structs must be set,
+// except for union values whose type is NONE.
+inline flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnumDense(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    Color color) {
+  static const flatbuffers::voffset_t vtable_[] = { 6, 8, 7 };
+  _fbb.Align(4);
+  const auto start_ = _fbb.StartTable();
+  _fbb.PushElement<int8_t>(static_cast<int8_t>(color));
+  return flatbuffers::Offset<TestSimpleTableWithEnum>(
+      _fbb.EndTableWithVtable(start_, vtable_, 728504716u));
+}
+
 flatbuffers::Offset<TestSimpleTableWithEnum> CreateTestSimpleTableWithEnum(flatbuffers::FlatBufferBuilder &_fbb, const TestSimpleTableWithEnumT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
 struct StatT : public flatbuffers::NativeTable {
   typedef Stat TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.Example.StatT";
+  }
   std::string id;
   int64_t val;
   uint16_t count;
@@ -489,6 +564,9 @@ struct StatT : public flatbuffers::NativeTable {
 
 struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef StatT NativeTableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.Example.Stat";
+  }
   enum {
     VT_ID = 4,
     VT_VAL = 6,
@@ -497,6 +575,10 @@ struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *id() const {
     return GetPointer<const flatbuffers::String *>(VT_ID);
   }
+  flatbuffers::string_view id_view() const {
+    auto s = id();
+    return s ? s->string_view() : flatbuffers::string_view();
+  }
   flatbuffers::String *mutable_id() {
     return GetPointer<flatbuffers::String *>(VT_ID);
   }
@@ -520,6 +602,29 @@ struct Stat FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<uint16_t>(verifier, VT_COUNT) &&
            verifier.EndTable();
   }
+  static void gather_val(const flatbuffers::Vector<flatbuffers::Offset<Stat>> &tables, int64_t *out) {
+    flatbuffers::GatherField<int64_t>(tables, VT_VAL, 0, out);
+  }
+  static void gather_count(const flatbuffers::Vector<flatbuffers::Offset<Stat>> &tables, uint16_t *out) {
+    flatbuffers::GatherField<uint16_t>(tables, VT_COUNT, 0, out);
+  }
+  struct View : public flatbuffers::TableView {
+    explicit View(const Stat *table)
+      : flatbuffers::TableView(table) {}
+    const flatbuffers::String *id() const {
+      return GetPointer<const flatbuffers::String *>(VT_ID);
+    }
+    int64_t val() const {
+      return GetField<int64_t>(VT_VAL, 0);
+    }
+    uint16_t count() const {
+      return GetField<uint16_t>(VT_COUNT, 0);
+    }
+  };
+  View view() const {
+    return View(this);
+  }
+  struct Checked;  // See flatbuffers::LazyVerifier.
   StatT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(StatT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Stat> Pack(flatbuffers::FlatBufferBuilder &_fbb, const StatT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -573,10 +678,33 @@ inline flatbuffers::Offset<Stat> CreateStatDirect(
       count);
 }
 
+// Like CreateStat, but writes all fields (even those equal to
+// their default) with a precomputed layout and vtable, which is faster.
+// Every argument must be passed, and all offsets and structs must be set,
+// except for union values whose type is NONE.
+inline flatbuffers::Offset<Stat> CreateStatDense(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    flatbuffers::Offset<flatbuffers::String> id,
+    int64_t val,
+    uint16_t count) {
+  static const flatbuffers::voffset_t vtable_[] = { 10, 20, 8, 12, 6 };
+  assert(!id.IsNull());
+  _fbb.Align(8);
+  const auto start_ = _fbb.StartTable();
+  _fbb.PushElement<int64_t>(val);
+  _fbb.PushElement(id);
+  _fbb.PushElement<uint16_t>(count);
+  return flatbuffers::Offset<Stat>(
+      _fbb.EndTableWithVtable(start_, vtable_, 247066833u));
+}
+
 flatbuffers::Offset<Stat> CreateStat(flatbuffers::FlatBufferBuilder &_fbb, const StatT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
 struct MonsterT : public flatbuffers::NativeTable {
   typedef Monster TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.Example.MonsterT";
+  }
   flatbuffers::unique_ptr<Vec3> pos;
   int16_t mana;
   int16_t hp;
@@ -632,6 +760,9 @@ struct MonsterT : public flatbuffers::NativeTable {
 /// an example documentation comment: monster object
 struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef MonsterT NativeTableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.Example.Monster";
+  }
   enum {
     VT_POS = 4,
     VT_MANA = 6,
@@ -689,6 +820,10 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *name() const {
     return GetPointer<const flatbuffers::String *>(VT_NAME);
   }
+  flatbuffers::string_view name_view() const {
+    auto s = name();
+    return s ? s->string_view() : flatbuffers::string_view();
+  }
   flatbuffers::String *mutable_name() {
     return GetPointer<flatbuffers::String *>(VT_NAME);
   }
@@ -701,6 +836,10 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<uint8_t> *inventory() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INVENTORY);
   }
+  flatbuffers::span<const uint8_t> inventory_span() const {
+    auto v = inventory();
+    return v ? flatbuffers::make_span(*v) : flatbuffers::span<const uint8_t>();
+  }
   flatbuffers::Vector<uint8_t> *mutable_inventory() {
     return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_INVENTORY);
   }
@@ -735,6 +874,10 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<const Test *> *test4() const {
     return GetPointer<const flatbuffers::Vector<const Test *> *>(VT_TEST4);
   }
+  flatbuffers::span<const Test> test4_span() const {
+    auto v = test4();
+    return v ? flatbuffers::make_span(*v) : flatbuffers::span<const Test>();
+  }
   flatbuffers::Vector<const Test *> *mutable_test4() {
     return GetPointer<flatbuffers::Vector<const Test *> *>(VT_TEST4);
   }
@@ -761,6 +904,10 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<uint8_t> *testnestedflatbuffer() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_TESTNESTEDFLATBUFFER);
   }
+  flatbuffers::span<const uint8_t> testnestedflatbuffer_span() const {
+    auto v = testnestedflatbuffer();
+    return v ? flatbuffers::make_span(*v) : flatbuffers::span<const uint8_t>();
+  }
   flatbuffers::Vector<uint8_t> *mutable_testnestedflatbuffer() {
     return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_TESTNESTEDFLATBUFFER);
   }
@@ -831,6 +978,10 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<uint8_t> *testarrayofbools() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_TESTARRAYOFBOOLS);
   }
+  flatbuffers::span<const uint8_t> testarrayofbools_span() const {
+    auto v = testarrayofbools();
+    return v ? flatbuffers::make_span(*v) : flatbuffers::span<const uint8_t>();
+  }
   flatbuffers::Vector<uint8_t> *mutable_testarrayofbools() {
     return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_TESTARRAYOFBOOLS);
   }
@@ -861,12 +1012,20 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<const Ability *> *testarrayofsortedstruct() const {
     return GetPointer<const flatbuffers::Vector<const Ability *> *>(VT_TESTARRAYOFSORTEDSTRUCT);
   }
+  flatbuffers::span<const Ability> testarrayofsortedstruct_span() const {
+    auto v = testarrayofsortedstruct();
+    return v ? flatbuffers::make_span(*v) : flatbuffers::span<const Ability>();
+  }
   flatbuffers::Vector<const Ability *> *mutable_testarrayofsortedstruct() {
     return GetPointer<flatbuffers::Vector<const Ability *> *>(VT_TESTARRAYOFSORTEDSTRUCT);
   }
   const flatbuffers::Vector<uint8_t> *flex() const {
     return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_FLEX);
   }
+  flatbuffers::span<const uint8_t> flex_span() const {
+    auto v = flex();
+    return v ? flatbuffers::make_span(*v) : flatbuffers::span<const uint8_t>();
+  }
   flatbuffers::Vector<uint8_t> *mutable_flex() {
     return GetPointer<flatbuffers::Vector<uint8_t> *>(VT_FLEX);
   }
@@ -877,18 +1036,34 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<const Test *> *test5() const {
     return GetPointer<const flatbuffers::Vector<const Test *> *>(VT_TEST5);
   }
+  flatbuffers::span<const Test> test5_span() const {
+    auto v = test5();
+    return v ? flatbuffers::make_span(*v) : flatbuffers::span<const Test>();
+  }
   flatbuffers::Vector<const Test *> *mutable_test5() {
     return GetPointer<flatbuffers::Vector<const Test *> *>(VT_TEST5);
   }
   const flatbuffers::Vector<int64_t> *vector_of_longs() const {
     return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_VECTOR_OF_LONGS);
   }
+#if FLATBUFFERS_LITTLEENDIAN
+  flatbuffers::span<const int64_t> vector_of_longs_span() const {
+    auto v = vector_of_longs();
+    return v ? flatbuffers::make_span(*v) : flatbuffers::span<const int64_t>();
+  }
+#endif
   flatbuffers::Vector<int64_t> *mutable_vector_of_longs() {
     return GetPointer<flatbuffers::Vector<int64_t> *>(VT_VECTOR_OF_LONGS);
   }
   const flatbuffers::Vector<double> *vector_of_doubles() const {
     return GetPointer<const flatbuffers::Vector<double> *>(VT_VECTOR_OF_DOUBLES);
   }
+#if FLATBUFFERS_LITTLEENDIAN
+  flatbuffers::span<const double> vector_of_doubles_span() const {
+    auto v = vector_of_doubles();
+    return v ? flatbuffers::make_span(*v) : flatbuffers::span<const double>();
+  }
+#endif
   flatbuffers::Vector<double> *mutable_vector_of_doubles() {
     return GetPointer<flatbuffers::Vector<double> *>(VT_VECTOR_OF_DOUBLES);
   }
@@ -956,6 +1131,164 @@ struct Monster FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyTable(parent_namespace_test()) &&
            verifier.EndTable();
   }
+  static void gather_mana(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int16_t *out) {
+    flatbuffers::GatherField<int16_t>(tables, VT_MANA, 150, out);
+  }
+  static void gather_hp(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int16_t *out) {
+    flatbuffers::GatherField<int16_t>(tables, VT_HP, 100, out);
+  }
+  static void gather_color(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int8_t *out) {
+    flatbuffers::GatherField<int8_t>(tables, VT_COLOR, 8, out);
+  }
+  static void gather_test_type(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, uint8_t *out) {
+    flatbuffers::GatherField<uint8_t>(tables, VT_TEST_TYPE, 0, out);
+  }
+  static void gather_testbool(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, uint8_t *out) {
+    flatbuffers::GatherField<uint8_t>(tables, VT_TESTBOOL, 0, out);
+  }
+  static void gather_testhashs32_fnv1(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int32_t *out) {
+    flatbuffers::GatherField<int32_t>(tables, VT_TESTHASHS32_FNV1, 0, out);
+  }
+  static void gather_testhashu32_fnv1(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, uint32_t *out) {
+    flatbuffers::GatherField<uint32_t>(tables, VT_TESTHASHU32_FNV1, 0, out);
+  }
+  static void gather_testhashs64_fnv1(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int64_t *out) {
+    flatbuffers::GatherField<int64_t>(tables, VT_TESTHASHS64_FNV1, 0, out);
+  }
+  static void gather_testhashu64_fnv1(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, uint64_t *out) {
+    flatbuffers::GatherField<uint64_t>(tables, VT_TESTHASHU64_FNV1, 0, out);
+  }
+  static void gather_testhashs32_fnv1a(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int32_t *out) {
+    flatbuffers::GatherField<int32_t>(tables, VT_TESTHASHS32_FNV1A, 0, out);
+  }
+  static void gather_testhashu32_fnv1a(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, uint32_t *out) {
+    flatbuffers::GatherField<uint32_t>(tables, VT_TESTHASHU32_FNV1A, 0, out);
+  }
+  static void gather_testhashs64_fnv1a(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, int64_t *out) {
+    flatbuffers::GatherField<int64_t>(tables, VT_TESTHASHS64_FNV1A, 0, out);
+  }
+  static void gather_testhashu64_fnv1a(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, uint64_t *out) {
+    flatbuffers::GatherField<uint64_t>(tables, VT_TESTHASHU64_FNV1A, 0, out);
+  }
+  static void gather_testf(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, float *out) {
+    flatbuffers::GatherField<float>(tables, VT_TESTF, 3.14159f, out);
+  }
+  static void gather_testf2(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, float *out) {
+    flatbuffers::GatherField<float>(tables, VT_TESTF2, 3.0f, out);
+  }
+  static void gather_testf3(const flatbuffers::Vector<flatbuffers::Offset<Monster>> &tables, float *out) {
+    flatbuffers::GatherField<float>(tables, VT_TESTF3, 0.0f, out);
+  }
+  struct View : public flatbuffers::TableView {
+    explicit View(const Monster *table)
+      : flatbuffers::TableView(table) {}
+    const Vec3 *pos() const {
+      return GetStruct<const Vec3 *>(VT_POS);
+    }
+    int16_t mana() const {
+      return GetField<int16_t>(VT_MANA, 150);
+    }
+    int16_t hp() const {
+      return GetField<int16_t>(VT_HP, 100);
+    }
+    const flatbuffers::String *name() const {
+      return GetPointer<const flatbuffers::String *>(VT_NAME);
+    }
+    const flatbuffers::Vector<uint8_t> *inventory() const {
+      return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INVENTORY);
+    }
+    Color color() const {
+      return static_cast<Color>(GetField<int8_t>(VT_COLOR, 8));
+    }
+    Any test_type() const {
+      return static_cast<Any>(GetField<uint8_t>(VT_TEST_TYPE, 0));
+    }
+    const void *test() const {
+      return GetPointer<const void *>(VT_TEST);
+    }
+    const flatbuffers::Vector<const Test *> *test4() const {
+      return GetPointer<const flatbuffers::Vector<const Test *> *>(VT_TEST4);
+    }
+    const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *testarrayofstring() const {
+      return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TESTARRAYOFSTRING);
+    }
+    const flatbuffers::Vector<flatbuffers::Offset<Monster>> *testarrayoftables() const {
+      return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<Monster>> *>(VT_TESTARRAYOFTABLES);
+    }
+    const Monster *enemy() const {
+      return GetPointer<const Monster *>(VT_ENEMY);
+    }
+    const flatbuffers::Vector<uint8_t> *testnestedflatbuffer() const {
+      return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_TESTNESTEDFLATBUFFER);
+    }
+    const Stat *testempty() const {
+      return GetPointer<const Stat *>(VT_TESTEMPTY);
+    }
+    bool testbool() const {
+      return GetField<uint8_t>(VT_TESTBOOL, 0) != 0;
+    }
+    int32_t testhashs32_fnv1() const {
+      return GetField<int32_t>(VT_TESTHASHS32_FNV1, 0);
+    }
+    uint32_t testhashu32_fnv1() const {
+      return GetField<uint32_t>(VT_TESTHASHU32_FNV1, 0);
+    }
+    int64_t testhashs64_fnv1() const {
+      return GetField<int64_t>(VT_TESTHASHS64_FNV1, 0);
+    }
+    uint64_t testhashu64_fnv1() const {
+      return GetField<uint64_t>(VT_TESTHASHU64_FNV1, 0);
+    }
+    int32_t testhashs32_fnv1a() const {
+      return GetField<int32_t>(VT_TESTHASHS32_FNV1A, 0);
+    }
+    uint32_t testhashu32_fnv1a() const {
+      return GetField<uint32_t>(VT_TESTHASHU32_FNV1A, 0);
+    }
+    int64_t testhashs64_fnv1a() const {
+      return GetField<int64_t>(VT_TESTHASHS64_FNV1A, 0);
+    }
+    uint64_t testhashu64_fnv1a() const {
+      return GetField<uint64_t>(VT_TESTHASHU64_FNV1A, 0);
+    }
+    const flatbuffers::Vector<uint8_t> *testarrayofbools() const {
+      return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_TESTARRAYOFBOOLS);
+    }
+    float testf() const {
+      return GetField<float>(VT_TESTF, 3.14159f);
+    }
+    float testf2() const {
+      return GetField<float>(VT_TESTF2, 3.0f);
+    }
+    float testf3() const {
+      return GetField<float>(VT_TESTF3, 0.0f);
+    }
+    const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *testarrayofstring2() const {
+      return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TESTARRAYOFSTRING2);
+    }
+    const flatbuffers::Vector<const Ability *> *testarrayofsortedstruct() const {
+      return GetPointer<const flatbuffers::Vector<const Ability *> *>(VT_TESTARRAYOFSORTEDSTRUCT);
+    }
+    const flatbuffers::Vector<uint8_t> *flex() const {
+      return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_FLEX);
+    }
+    const flatbuffers::Vector<const Test *> *test5() const {
+      return GetPointer<const flatbuffers::Vector<const Test *> *>(VT_TEST5);
+    }
+    const flatbuffers::Vector<int64_t> *vector_of_longs() const {
+      return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_VECTOR_OF_LONGS);
+    }
+    const flatbuffers::Vector<double> *vector_of_doubles() const {
+      return GetPointer<const flatbuffers::Vector<double> *>(VT_VECTOR_OF_DOUBLES);
+    }
+    const MyGame::InParentNamespace *parent_namespace_test() const {
+      return GetPointer<const MyGame::InParentNamespace *>(VT_PARENT_NAMESPACE_TEST);
+    }
+  };
+  View view() const {
+    return View(this);
+  }
+  struct Checked;  // See flatbuffers::LazyVerifier.
   MonsterT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(MonsterT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<Monster> Pack(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -1239,10 +1572,119 @@ inline flatbuffers::Offset<Monster> CreateMonsterDirect(
       parent_namespace_test);
 }
 
+// Like CreateMonster, but writes all fields (even those equal to
+// their default) with a precomputed layout and vtable, which is faster.
+// Every argument must be passed, and all offsets and structs must be set,
+// except for union values whose type is NONE.
+inline flatbuffers::Offset<Monster> CreateMonsterDense(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    const Vec3 *pos,
+    int16_t mana,
+    int16_t hp,
+    flatbuffers::Offset<flatbuffers::String> name,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> inventory,
+    Color color,
+    Any test_type,
+    flatbuffers::Offset<void> test,
+    flatbuffers::Offset<flatbuffers::Vector<const Test *>> test4,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> testarrayofstring,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Monster>>> testarrayoftables,
+    flatbuffers::Offset<Monster> enemy,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> testnestedflatbuffer,
+    flatbuffers::Offset<Stat> testempty,
+    bool testbool,
+    int32_t testhashs32_fnv1,
+    uint32_t testhashu32_fnv1,
+    int64_t testhashs64_fnv1,
+    uint64_t testhashu64_fnv1,
+    int32_t testhashs32_fnv1a,
+    uint32_t testhashu32_fnv1a,
+    int64_t testhashs64_fnv1a,
+    uint64_t testhashu64_fnv1a,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> testarrayofbools,
+    float testf,
+    float testf2,
+    float testf3,
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>> testarrayofstring2,
+    flatbuffers::Offset<flatbuffers::Vector<const Ability *>> testarrayofsortedstruct,
+    flatbuffers::Offset<flatbuffers::Vector<uint8_t>> flex,
+    flatbuffers::Offset<flatbuffers::Vector<const Test *>> test5,
+    flatbuffers::Offset<flatbuffers::Vector<int64_t>> vector_of_longs,
+    flatbuffers::Offset<flatbuffers::Vector<double>> vector_of_doubles,
+    flatbuffers::Offset<MyGame::InParentNamespace> parent_namespace_test) {
+  flatbuffers::voffset_t vtable_[] = { 74, 172, 140, 8, 10, 12, 0, 16, 5, 6, 20, 24, 28, 32, 36, 40, 44, 7, 48, 52, 108, 116, 56, 60, 124, 132, 64, 68, 72, 76, 80, 84, 88, 92, 96, 100, 104 };
+  uint32_t vtable_hash_ = 2823845273u;
+  assert(pos);
+  assert(!name.IsNull());
+  assert(!inventory.IsNull());
+  if (test_type == Any_NONE) {
+    vtable_[10] = 0;
+    vtable_hash_ = flatbuffers::FlatBufferBuilder::HashVtable(vtable_);
+  } else {
+    assert(!test.IsNull());
+  }
+  assert(!test4.IsNull());
+  assert(!testarrayofstring.IsNull());
+  assert(!testarrayoftables.IsNull());
+  assert(!enemy.IsNull());
+  assert(!testnestedflatbuffer.IsNull());
+  assert(!testempty.IsNull());
+  assert(!testarrayofbools.IsNull());
+  assert(!testarrayofstring2.IsNull());
+  assert(!testarrayofsortedstruct.IsNull());
+  assert(!flex.IsNull());
+  assert(!test5.IsNull());
+  assert(!vector_of_longs.IsNull());
+  assert(!vector_of_doubles.IsNull());
+  assert(!parent_namespace_test.IsNull());
+  _fbb.Align(16);
+  const auto start_ = _fbb.StartTable();
+  _fbb.CreateStruct(*pos);
+  _fbb.PushElement<uint64_t>(testhashu64_fnv1a);
+  _fbb.PushElement<int64_t>(testhashs64_fnv1a);
+  _fbb.PushElement<uint64_t>(testhashu64_fnv1);
+  _fbb.PushElement<int64_t>(testhashs64_fnv1);
+  _fbb.PushElement(parent_namespace_test);
+  _fbb.PushElement(vector_of_doubles);
+  _fbb.PushElement(vector_of_longs);
+  _fbb.PushElement(test5);
+  _fbb.PushElement(flex);
+  _fbb.PushElement(testarrayofsortedstruct);
+  _fbb.PushElement(testarrayofstring2);
+  _fbb.PushElement<float>(testf3);
+  _fbb.PushElement<float>(testf2);
+  _fbb.PushElement<float>(testf);
+  _fbb.PushElement(testarrayofbools);
+  _fbb.PushElement<uint32_t>(testhashu32_fnv1a);
+  _fbb.PushElement<int32_t>(testhashs32_fnv1a);
+  _fbb.PushElement<uint32_t>(testhashu32_fnv1);
+  _fbb.PushElement<int32_t>(testhashs32_fnv1);
+  _fbb.PushElement(testempty);
+  _fbb.PushElement(testnestedflatbuffer);
+  _fbb.PushElement(enemy);
+  _fbb.PushElement(testarrayoftables);
+  _fbb.PushElement(testarrayofstring);
+  _fbb.PushElement(test4);
+  if (test.IsNull()) _fbb.PushElement<flatbuffers::uoffset_t>(0);
+  else _fbb.PushElement(test);
+  _fbb.PushElement(inventory);
+  _fbb.PushElement(name);
+  _fbb.PushElement<int16_t>(hp);
+  _fbb.PushElement<int16_t>(mana);
+  _fbb.PushElement<uint8_t>(static_cast<uint8_t>(testbool));
+  _fbb.PushElement<uint8_t>(static_cast<uint8_t>(test_type));
+  _fbb.PushElement<int8_t>(static_cast<int8_t>(color));
+  return flatbuffers::Offset<Monster>(
+      _fbb.EndTableWithVtable(start_, vtable_, vtable_hash_));
+}
+
 flatbuffers::Offset<Monster> CreateMonster(flatbuffers::FlatBufferBuilder &_fbb, const MonsterT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
 struct TypeAliasesT : public flatbuffers::NativeTable {
   typedef TypeAliases TableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.Example.TypeAliasesT";
+  }
   int8_t i8;
   uint8_t u8;
   int16_t i16;
@@ -1271,6 +1713,9 @@ struct TypeAliasesT : public flatbuffers::NativeTable {
 
 struct TypeAliases FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   typedef TypeAliasesT NativeTableType;
+  static FLATBUFFERS_CONSTEXPR const char *GetFullyQualifiedName() {
+    return "MyGame.Example.TypeAliases";
+  }
   enum {
     VT_I8 = 4,
     VT_U8 = 6,
@@ -1348,12 +1793,22 @@ struct TypeAliases FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<int8_t> *v8() const {
     return GetPointer<const flatbuffers::Vector<int8_t> *>(VT_V8);
   }
+  flatbuffers::span<const int8_t> v8_span() const {
+    auto v = v8();
+    return v ? flatbuffers::make_span(*v) : flatbuffers::span<const int8_t>();
+  }
   flatbuffers::Vector<int8_t> *mutable_v8() {
     return GetPointer<flatbuffers::Vector<int8_t> *>(VT_V8);
   }
   const flatbuffers::Vector<double> *vf64() const {
     return GetPointer<const flatbuffers::Vector<double> *>(VT_VF64);
   }
+#if FLATBUFFERS_LITTLEENDIAN
+  flatbuffers::span<const double> vf64_span() const {
+    auto v = vf64();
+    return v ? flatbuffers::make_span(*v) : flatbuffers::span<const double>();
+  }
+#endif
   flatbuffers::Vector<double> *mutable_vf64() {
     return GetPointer<flatbuffers::Vector<double> *>(VT_VF64);
   }
@@ -1375,6 +1830,80 @@ struct TypeAliases FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.Verify(vf64()) &&
            verifier.EndTable();
   }
+  static void gather_i8(const flatbuffers::Vector<flatbuffers::Offset<TypeAliases>> &tables, int8_t *out) {
+    flatbuffers::GatherField<int8_t>(tables, VT_I8, 0, out);
+  }
+  static void gather_u8(const flatbuffers::Vector<flatbuffers::Offset<TypeAliases>> &tables, uint8_t *out) {
+    flatbuffers::GatherField<uint8_t>(tables, VT_U8, 0, out);
+  }
+  static void gather_i16(const flatbuffers::Vector<flatbuffers::Offset<TypeAliases>> &tables, int16_t *out) {
+    flatbuffers::GatherField<int16_t>(tables, VT_I16, 0, out);
+  }
+  static void gather_u16(const flatbuffers::Vector<flatbuffers::Offset<TypeAliases>> &tables, uint16_t *out) {
+    flatbuffers::GatherField<uint16_t>(tables, VT_U16, 0, out);
+  }
+  static void gather_i32(const flatbuffers::Vector<flatbuffers::Offset<TypeAliases>> &tables, int32_t *out) {
+    flatbuffers::GatherField<int32_t>(tables, VT_I32, 0, out);
+  }
+  static void gather_u32(const flatbuffers::Vector<flatbuffers::Offset<TypeAliases>> &tables, uint32_t *out) {
+    flatbuffers::GatherField<uint32_t>(tables, VT_U32, 0, out);
+  }
+  static void gather_i64(const flatbuffers::Vector<flatbuffers::Offset<TypeAliases>> &tables, int64_t *out) {
+    flatbuffers::GatherField<int64_t>(tables, VT_I64, 0, out);
+  }
+  static void gather_u64(const flatbuffers::Vector<flatbuffers::Offset<TypeAliases>> &tables, uint64_t *out) {
+    flatbuffers::GatherField<uint64_t>(tables, VT_U64, 0, out);
+  }
+  static void gather_f32(const flatbuffers::Vector<flatbuffers::Offset<TypeAliases>> &tables, float *out) {
+    flatbuffers::GatherField<float>(tables, VT_F32, 0.0f, out);
+  }
+  static void gather_f64(const flatbuffers::Vector<flatbuffers::Offset<TypeAliases>> &tables, double *out) {
+    flatbuffers::GatherField<double>(tables, VT_F64, 0.0, out);
+  }
+  struct View : public flatbuffers::TableView {
+    explicit View(const TypeAliases *table)
+      : flatbuffers::TableView(table) {}
+    int8_t i8() const {
+      return GetField<int8_t>(VT_I8, 0);
+    }
+    uint8_t u8() const {
+      return GetField<uint8_t>(VT_U8, 0);
+    }
+    int16_t i16() const {
+      return GetField<int16_t>(VT_I16, 0);
+    }
+    uint16_t u16() const {
+      return GetField<uint16_t>(VT_U16, 0);
+    }
+    int32_t i32() const {
+      return GetField<int32_t>(VT_I32, 0);
+    }
+    uint32_t u32() const {
+      return GetField<uint32_t>(VT_U32, 0);
+    }
+    int64_t i64() const {
+      return GetField<int64_t>(VT_I64, 0);
+    }
+    uint64_t u64() const {
+      return GetField<uint64_t>(VT_U64, 0);
+    }
+    float f32() const {
+      return GetField<float>(VT_F32, 0.0f);
+    }
+    double f64() const {
+      return GetField<double>(VT_F64, 0.0);
+    }
+    const flatbuffers::Vector<int8_t> *v8() const {
+      return GetPointer<const flatbuffers::Vector<int8_t> *>(VT_V8);
+    }
+    const flatbuffers::Vector<double> *vf64() const {
+      return GetPointer<const flatbuffers::Vector<double> *>(VT_VF64);
+    }
+  };
+  View view() const {
+    return View(this);
+  }
+  struct Checked;  // See flatbuffers::LazyVerifier.
   TypeAliasesT *UnPack(const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   void UnPackTo(TypeAliasesT *_o, const flatbuffers::resolver_function_t *_resolver = nullptr) const;
   static flatbuffers::Offset<TypeAliases> Pack(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT* _o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
@@ -1491,6 +2020,45 @@ inline flatbuffers::Offset<TypeAliases> CreateTypeAliasesDirect(
       vf64 ? _fbb.CreateVector<double>(*vf64) : 0);
 }
 
+// Like CreateTypeAliases, but writes all fields (even those equal to
+// their default) with a precomputed layout and vtable, which is faster.
+// Every argument must be passed, and all offsets and structs must be set,
+// except for union values whose type is NONE.
+inline flatbuffers::Offset<TypeAliases> CreateTypeAliasesDense(
+    flatbuffers::FlatBufferBuilder &_fbb,
+    int8_t i8,
+    uint8_t u8,
+    int16_t i16,
+    uint16_t u16,
+    int32_t i32,
+    uint32_t u32,
+    int64_t i64,
+    uint64_t u64,
+    float f32,
+    double f64,
+    flatbuffers::Offset<flatbuffers::Vector<int8_t>> v8,
+    flatbuffers::Offset<flatbuffers::Vector<double>> vf64) {
+  static const flatbuffers::voffset_t vtable_[] = { 28, 56, 6, 7, 8, 10, 12, 16, 32, 40, 20, 48, 24, 28 };
+  assert(!v8.IsNull());
+  assert(!vf64.IsNull());
+  _fbb.Align(8);
+  const auto start_ = _fbb.StartTable();
+  _fbb.PushElement<double>(f64);
+  _fbb.PushElement<uint64_t>(u64);
+  _fbb.PushElement<int64_t>(i64);
+  _fbb.PushElement(vf64);
+  _fbb.PushElement(v8);
+  _fbb.PushElement<float>(f32);
+  _fbb.PushElement<uint32_t>(u32);
+  _fbb.PushElement<int32_t>(i32);
+  _fbb.PushElement<uint16_t>(u16);
+  _fbb.PushElement<int16_t>(i16);
+  _fbb.PushElement<uint8_t>(u8);
+  _fbb.PushElement<int8_t>(i8);
+  return flatbuffers::Offset<TypeAliases>(
+      _fbb.EndTableWithVtable(start_, vtable_, 1595501502u));
+}
+
 flatbuffers::Offset<TypeAliases> CreateTypeAliases(flatbuffers::FlatBufferBuilder &_fbb, const TypeAliasesT *_o, const flatbuffers::rehasher_function_t *_rehasher = nullptr);
 
 }  // namespace Example
@@ -1789,6 +2357,218 @@ inline flatbuffers::Offset<TypeAliases> CreateTypeAliases(flatbuffers::FlatBuffe
       _vf64);
 }
 
+}  // namespace Example
+
+struct InParentNamespace::Checked : public flatbuffers::CheckedTable {
+  Checked(const InParentNamespace *table, flatbuffers::LazyVerifier *lazy)
+    : flatbuffers::CheckedTable(table, lazy) {}
+};
+
+namespace Example2 {
+
+struct Monster::Checked : public flatbuffers::CheckedTable {
+  Checked(const Monster *table, flatbuffers::LazyVerifier *lazy)
+    : flatbuffers::CheckedTable(table, lazy) {}
+};
+
+}  // namespace Example2
+
+namespace Example {
+
+struct TestSimpleTableWithEnum::Checked : public flatbuffers::CheckedTable {
+  Checked(const TestSimpleTableWithEnum *table, flatbuffers::LazyVerifier *lazy)
+    : flatbuffers::CheckedTable(table, lazy) {}
+  Color color() const {
+    return static_cast<Color>(GetField<int8_t>(VT_COLOR, 2));
+  }
+};
+
+struct Stat::Checked : public flatbuffers::CheckedTable {
+  Checked(const Stat *table, flatbuffers::LazyVerifier *lazy)
+    : flatbuffers::CheckedTable(table, lazy) {}
+  const flatbuffers::String *id() const {
+    return GetPointer<const flatbuffers::String *>(VT_ID);
+  }
+  int64_t val() const {
+    return GetField<int64_t>(VT_VAL, 0);
+  }
+  uint16_t count() const {
+    return GetField<uint16_t>(VT_COUNT, 0);
+  }
+};
+
+struct Monster::Checked : public flatbuffers::CheckedTable {
+  Checked(const Monster *table, flatbuffers::LazyVerifier *lazy)
+    : flatbuffers::CheckedTable(table, lazy) {}
+  const Vec3 *pos() const {
+    return GetStruct<const Vec3 *>(VT_POS);
+  }
+  int16_t mana() const {
+    return GetField<int16_t>(VT_MANA, 150);
+  }
+  int16_t hp() const {
+    return GetField<int16_t>(VT_HP, 100);
+  }
+  const flatbuffers::String *name() const {
+    return GetPointer<const flatbuffers::String *>(VT_NAME);
+  }
+  const flatbuffers::Vector<uint8_t> *inventory() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_INVENTORY);
+  }
+  Color color() const {
+    return static_cast<Color>(GetField<int8_t>(VT_COLOR, 8));
+  }
+  Any test_type() const {
+    return static_cast<Any>(GetField<uint8_t>(VT_TEST_TYPE, 0));
+  }
+  Monster::Checked test_as_Monster() const;
+  TestSimpleTableWithEnum::Checked test_as_TestSimpleTableWithEnum() const;
+  MyGame::Example2::Monster::Checked test_as_MyGame_Example2_Monster() const;
+  const flatbuffers::Vector<const Test *> *test4() const {
+    return GetPointer<const flatbuffers::Vector<const Test *> *>(VT_TEST4);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *testarrayofstring() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TESTARRAYOFSTRING);
+  }
+  flatbuffers::CheckedVectorOfTables<Monster> testarrayoftables() const {
+    return GetVectorOfTables<Monster>(VT_TESTARRAYOFTABLES);
+  }
+  Monster::Checked enemy() const;
+  const flatbuffers::Vector<uint8_t> *testnestedflatbuffer() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_TESTNESTEDFLATBUFFER);
+  }
+  Stat::Checked testempty() const;
+  bool testbool() const {
+    return GetField<uint8_t>(VT_TESTBOOL, 0) != 0;
+  }
+  int32_t testhashs32_fnv1() const {
+    return GetField<int32_t>(VT_TESTHASHS32_FNV1, 0);
+  }
+  uint32_t testhashu32_fnv1() const {
+    return GetField<uint32_t>(VT_TESTHASHU32_FNV1, 0);
+  }
+  int64_t testhashs64_fnv1() const {
+    return GetField<int64_t>(VT_TESTHASHS64_FNV1, 0);
+  }
+  uint64_t testhashu64_fnv1() const {
+    return GetField<uint64_t>(VT_TESTHASHU64_FNV1, 0);
+  }
+  int32_t testhashs32_fnv1a() const {
+    return GetField<int32_t>(VT_TESTHASHS32_FNV1A, 0);
+  }
+  uint32_t testhashu32_fnv1a() const {
+    return GetField<uint32_t>(VT_TESTHASHU32_FNV1A, 0);
+  }
+  int64_t testhashs64_fnv1a() const {
+    return GetField<int64_t>(VT_TESTHASHS64_FNV1A, 0);
+  }
+  uint64_t testhashu64_fnv1a() const {
+    return GetField<uint64_t>(VT_TESTHASHU64_FNV1A, 0);
+  }
+  const flatbuffers::Vector<uint8_t> *testarrayofbools() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_TESTARRAYOFBOOLS);
+  }
+  float testf() const {
+    return GetField<float>(VT_TESTF, 3.14159f);
+  }
+  float testf2() const {
+    return GetField<float>(VT_TESTF2, 3.0f);
+  }
+  float testf3() const {
+    return GetField<float>(VT_TESTF3, 0.0f);
+  }
+  const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *testarrayofstring2() const {
+    return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>> *>(VT_TESTARRAYOFSTRING2);
+  }
+  const flatbuffers::Vector<const Ability *> *testarrayofsortedstruct() const {
+    return GetPointer<const flatbuffers::Vector<const Ability *> *>(VT_TESTARRAYOFSORTEDSTRUCT);
+  }
+  const flatbuffers::Vector<uint8_t> *flex() const {
+    return GetPointer<const flatbuffers::Vector<uint8_t> *>(VT_FLEX);
+  }
+  const flatbuffers::Vector<const Test *> *test5() const {
+    return GetPointer<const flatbuffers::Vector<const Test *> *>(VT_TEST5);
+  }
+  const flatbuffers::Vector<int64_t> *vector_of_longs() const {
+    return GetPointer<const flatbuffers::Vector<int64_t> *>(VT_VECTOR_OF_LONGS);
+  }
+  const flatbuffers::Vector<double> *vector_of_doubles() const {
+    return GetPointer<const flatbuffers::Vector<double> *>(VT_VECTOR_OF_DOUBLES);
+  }
+  MyGame::InParentNamespace::Checked parent_namespace_test() const;
+};
+
+struct TypeAliases::Checked : public flatbuffers::CheckedTable {
+  Checked(const TypeAliases *table, flatbuffers::LazyVerifier *lazy)
+    : flatbuffers::CheckedTable(table, lazy) {}
+  int8_t i8() const {
+    return GetField<int8_t>(VT_I8, 0);
+  }
+  uint8_t u8() const {
+    return GetField<uint8_t>(VT_U8, 0);
+  }
+  int16_t i16() const {
+    return GetField<int16_t>(VT_I16, 0);
+  }
+  uint16_t u16() const {
+    return GetField<uint16_t>(VT_U16, 0);
+  }
+  int32_t i32() const {
+    return GetField<int32_t>(VT_I32, 0);
+  }
+  uint32_t u32() const {
+    return GetField<uint32_t>(VT_U32, 0);
+  }
+  int64_t i64() const {
+    return GetField<int64_t>(VT_I64, 0);
+  }
+  uint64_t u64() const {
+    return GetField<uint64_t>(VT_U64, 0);
+  }
+  float f32() const {
+    return GetField<float>(VT_F32, 0.0f);
+  }
+  double f64() const {
+    return GetField<double>(VT_F64, 0.0);
+  }
+  const flatbuffers::Vector<int8_t> *v8() const {
+    return GetPointer<const flatbuffers::Vector<int8_t> *>(VT_V8);
+  }
+  const flatbuffers::Vector<double> *vf64() const {
+    return GetPointer<const flatbuffers::Vector<double> *>(VT_VF64);
+  }
+};
+
+inline Monster::Checked Monster::Checked::test_as_Monster() const {
+  return test_type() == Any_Monster
+      ? GetTable<Monster>(VT_TEST)
+      : Monster::Checked(nullptr, lazy_);
+}
+
+inline TestSimpleTableWithEnum::Checked Monster::Checked::test_as_TestSimpleTableWithEnum() const {
+  return test_type() == Any_TestSimpleTableWithEnum
+      ? GetTable<TestSimpleTableWithEnum>(VT_TEST)
+      : TestSimpleTableWithEnum::Checked(nullptr, lazy_);
+}
+
+inline MyGame::Example2::Monster::Checked Monster::Checked::test_as_MyGame_Example2_Monster() const {
+  return test_type() == Any_MyGame_Example2_Monster
+      ? GetTable<MyGame::Example2::Monster>(VT_TEST)
+      : MyGame::Example2::Monster::Checked(nullptr, lazy_);
+}
+
+inline Monster::Checked Monster::Checked::enemy() const {
+  return GetTable<Monster>(VT_ENEMY);
+}
+
+inline Stat::Checked Monster::Checked::testempty() const {
+  return GetTable<Stat>(VT_TESTEMPTY);
+}
+
+inline MyGame::InParentNamespace::Checked Monster::Checked::parent_namespace_test() const {
+  return GetTable<MyGame::InParentNamespace>(VT_PARENT_NAMESPACE_TEST);
+}
+
 inline bool VerifyAny(flatbuffers::Verifier &verifier, const void *obj, Any type) {
   switch (type) {
     case Any_NONE: {
@@ -2233,6 +3013,11 @@ inline bool VerifyMonsterBuffer(
   return verifier.VerifyBuffer<MyGame::Example::Monster>(MonsterIdentifier());
 }
 
+inline MyGame::Example::Monster::Checked GetCheckedMonster(
+    flatbuffers::LazyVerifier &lazy) {
+  return flatbuffers::GetCheckedRoot<MyGame::Example::Monster>(lazy, MonsterIdentifier());
+}
+
 inline const char *MonsterExtension() {
   return "mon";
 }
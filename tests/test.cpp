@@ -15,6 +15,8 @@
  */
 
 #include "flatbuffers/flatbuffers.h"
+#include "flatbuffers/builder_pool.h"
+#include "flatbuffers/thread_pool.h"
 #include "flatbuffers/idl.h"
 #include "flatbuffers/util.h"
 #include "flatbuffers/registry.h"
@@ -24,6 +26,7 @@
 #include "namespace_test/namespace_test1_generated.h"
 #include "namespace_test/namespace_test2_generated.h"
 #include "union_vector/union_vector_generated.h"
+#include "key_index/key_index_generated.h"
 
 #ifndef FLATBUFFERS_CPP98_STL
   #include <random>
@@ -526,6 +529,1342 @@ void SizePrefixedTest() {
   TEST_EQ_STR(m->name()->c_str(), "bob");
 }
 
+// Build tables in many different shapes, and make sure each distinct vtable
+// only ends up in the buffer once.
+void VtableDedupTest() {
+  const flatbuffers::voffset_t num_fields = 10;
+  const int num_shapes = 1 << num_fields;
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::uoffset_t> objects;
+  for (int round = 0; round < 2; round++) {
+    for (int shape = 0; shape < num_shapes; shape++) {
+      auto start = builder.StartTable();
+      for (flatbuffers::voffset_t f = 0; f < num_fields; f++) {
+        if (shape & (1 << f)) {
+          builder.AddElement<int32_t>(flatbuffers::FieldIndexToOffset(f),
+                                      shape, 0);
+        }
+      }
+      objects.push_back(builder.EndTable(start));
+    }
+  }
+  auto eob = builder.GetCurrentBufferPointer() + builder.GetSize();
+  std::set<const uint8_t *> vtables;
+  std::set<std::string> layouts;
+  for (size_t i = 0; i < objects.size(); i++) {
+    auto table = reinterpret_cast<flatbuffers::Table *>(eob - objects[i]);
+    auto vtable = table->GetVTable();
+    vtables.insert(vtable);
+    layouts.insert(std::string(reinterpret_cast<const char *>(vtable),
+      flatbuffers::ReadScalar<flatbuffers::voffset_t>(vtable)));
+    int shape = static_cast<int>(i) % num_shapes;
+    for (flatbuffers::voffset_t f = 0; f < num_fields; f++) {
+      TEST_EQ(table->GetField<int32_t>(flatbuffers::FieldIndexToOffset(f), 0),
+              shape & (1 << f) ? shape : 0);
+    }
+  }
+  // Every distinct layout must have been written exactly once.
+  TEST_EQ(vtables.size(), layouts.size());
+  TEST_EQ(vtables.size() < objects.size(), true);
+
+  // After a Clear(), the same tables must serialize to the same bytes as they
+  // would in a fresh builder.
+  std::string first;
+  for (int pass = 0; pass < 2; pass++) {
+    builder.Clear();
+    for (int shape = 0; shape < 3; shape++) {
+      auto start = builder.StartTable();
+      builder.AddElement<int16_t>(flatbuffers::FieldIndexToOffset(0),
+                                  static_cast<int16_t>(shape + 1), 0);
+      builder.EndTable(start);
+    }
+    std::string bytes(
+      reinterpret_cast<const char *>(builder.GetCurrentBufferPointer()),
+      builder.GetSize());
+    if (pass) TEST_EQ(bytes == first, true); else first = bytes;
+  }
+}
+
+// Shared strings must survive the buffer growing, and Clear().
+void SharedStringTest() {
+  flatbuffers::FlatBufferBuilder builder(64);
+  for (int pass = 0; pass < 2; pass++) {
+    builder.Clear();
+    std::vector<flatbuffers::Offset<flatbuffers::String>> first;
+    const int num_strings = 1000;
+    for (int i = 0; i < num_strings; i++) {
+      first.push_back(builder.CreateSharedString(
+        "tag" + flatbuffers::NumToString(i)));
+    }
+    // Again, after the buffer has been reallocated many times.
+    auto size = builder.GetSize();
+    for (int i = 0; i < num_strings; i++) {
+      auto off = builder.CreateSharedString(
+        "tag" + flatbuffers::NumToString(i));
+      TEST_EQ(off.o, first[i].o);
+    }
+    TEST_EQ(builder.GetSize(), size);
+  }
+  // Strings that only differ after an embedded 0 are not the same string.
+  auto a = builder.CreateSharedString("a\0b", 3);
+  auto b = builder.CreateSharedString("a\0c", 3);
+  auto c = builder.CreateSharedString("a", 1);
+  TEST_EQ(a.o != b.o, true);
+  TEST_EQ(a.o != c.o, true);
+  TEST_EQ(builder.CreateSharedString("a\0b", 3).o, a.o);
+}
+
+// Builds a buffer with many monsters in it, deterministically, to test
+// builder features on larger buffers.
+void CreateManyMonsters(flatbuffers::FlatBufferBuilder &builder,
+                        int num_monsters) {
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < num_monsters; i++) {
+    auto name = builder.CreateSharedString(
+      "monster" + flatbuffers::NumToString(i % 100));
+    std::vector<uint8_t> inventory(i % 37, static_cast<uint8_t>(i));
+    auto pos = Vec3(1, 2, static_cast<float>(i), 0, Color_Red, Test(10, 20));
+    monsters.push_back(CreateMonster(builder, &pos, 150,
+                                     static_cast<int16_t>(i), name,
+                                     builder.CreateVector(inventory)));
+  }
+  auto root = CreateMonster(builder, nullptr, 150, 100,
+                            builder.CreateString("root"), 0, Color_Blue,
+                            Any_NONE, 0, 0, 0,
+                            builder.CreateVector(monsters));
+  FinishMonsterBuffer(builder, root);
+}
+
+// Building with segments must give the same bytes as building into a
+// single block.
+void SegmentedBuilderTest() {
+  const int num_monsters = 500;
+  flatbuffers::FlatBufferBuilder reference;
+  CreateManyMonsters(reference, num_monsters);
+  std::string expected(
+    reinterpret_cast<const char *>(reference.GetBufferPointer()),
+    reference.GetSize());
+
+  flatbuffers::FlatBufferBuilder builder(256);
+  builder.UseSegments(256);
+  for (int pass = 0; pass < 2; pass++) {
+    builder.Clear();
+    CreateManyMonsters(builder, num_monsters);
+    auto segments = builder.GetBufferSegments();
+    TEST_EQ(segments.size() > 1, true);
+    std::string gathered;
+    for (auto it = segments.begin(); it != segments.end(); ++it) {
+      gathered.append(reinterpret_cast<const char *>(it->first), it->second);
+    }
+    TEST_EQ(gathered == expected, true);
+  }
+
+  builder.Clear();
+  CreateManyMonsters(builder, num_monsters);
+  auto buf = builder.Release();
+  TEST_EQ(std::string(reinterpret_cast<const char *>(buf.data()),
+                      buf.size()) == expected, true);
+  flatbuffers::Verifier verifier(buf.data(), buf.size());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  auto monsters = GetMonster(buf.data())->testarrayoftables();
+  TEST_EQ(monsters->size(), static_cast<flatbuffers::uoffset_t>(num_monsters));
+  TEST_EQ(monsters->Get(123)->hp(), 123);
+  TEST_EQ_STR(monsters->Get(123)->name()->c_str(), "monster23");
+}
+
+// Allocator that counts its allocations.
+class CountingAllocator : public flatbuffers::DefaultAllocator {
+ public:
+  CountingAllocator() : allocations(0), deallocations(0) {}
+
+  virtual uint8_t *allocate(size_t size) FLATBUFFERS_OVERRIDE {
+    allocations++;
+    return DefaultAllocator::allocate(size);
+  }
+
+  virtual void deallocate(uint8_t *p, size_t size) FLATBUFFERS_OVERRIDE {
+    deallocations++;
+    DefaultAllocator::deallocate(p, size);
+  }
+
+  int allocations;
+  int deallocations;
+};
+
+void BuilderPoolTest() {
+  CountingAllocator allocator;
+  {
+    flatbuffers::BuilderPool pool(64 * 1024, 4, 1024, &allocator);
+    flatbuffers::FlatBufferBuilder *first = nullptr;
+    {
+      auto fbb = pool.Acquire();
+      first = fbb.get();
+      CreateManyMonsters(*fbb, 100);
+      flatbuffers::Verifier verifier(fbb->GetBufferPointer(), fbb->GetSize());
+      TEST_EQ(VerifyMonsterBuffer(verifier), true);
+    }
+    // Once warm, a builder is reused without allocating.
+    auto allocations = allocator.allocations;
+    {
+      auto fbb = pool.Acquire();
+      TEST_EQ(fbb.get(), first);
+      TEST_EQ(fbb->GetSize(), 0U);
+      CreateManyMonsters(*fbb, 100);
+      // Using two builders at once gives two different builders (which
+      // does not allocate until it is written to).
+      auto fbb2 = pool.Acquire();
+      TEST_EQ(fbb2.get() != first, true);
+    }
+    TEST_EQ(allocator.allocations, allocations);
+
+    // Releasing the buffer hands its memory to the DetachedBuffer.
+    flatbuffers::DetachedBuffer buf;
+    {
+      auto fbb = pool.Acquire();
+      CreateManyMonsters(*fbb, 100);
+      buf = fbb.Release();
+      TEST_EQ(fbb.get(), static_cast<flatbuffers::FlatBufferBuilder *>(nullptr));
+    }
+    flatbuffers::Verifier verifier(buf.data(), buf.size());
+    TEST_EQ(VerifyMonsterBuffer(verifier), true);
+    // The builder is still usable after that.
+    {
+      auto fbb = pool.Acquire();
+      CreateManyMonsters(*fbb, 10);
+      flatbuffers::Verifier verifier2(fbb->GetBufferPointer(), fbb->GetSize());
+      TEST_EQ(VerifyMonsterBuffer(verifier2), true);
+    }
+
+    // A buffer bigger than the retained size is freed when returned.
+    auto deallocations = allocator.deallocations;
+    {
+      auto fbb = pool.Acquire();
+      CreateManyMonsters(*fbb, 10000);
+      TEST_EQ(fbb->GetSize() > 64 * 1024, true);
+      deallocations = allocator.deallocations;
+    }
+    TEST_EQ(allocator.deallocations, deallocations + 1);
+  }
+  TEST_EQ(allocator.allocations, allocator.deallocations);
+}
+
+// Builders acquired concurrently must never be handed to two threads at
+// once, whether they come from a thread's cache or from the shared slots.
+void BuilderPoolThreadsTest() {
+  const int num_threads = 8;
+  const int iterations = 200;
+  flatbuffers::BuilderPool pool(64 * 1024, 4);
+  std::atomic<int> failures(0);
+  // Builds a monster unique to this thread and iteration, and checks that
+  // nothing else wrote to the builder meanwhile.
+  auto build = [&](flatbuffers::FlatBufferBuilder &fbb, int id) {
+    if (fbb.GetSize()) failures++;
+    auto name = fbb.CreateString("monster" + flatbuffers::NumToString(id));
+    std::vector<uint8_t> inventory(id % 37, static_cast<uint8_t>(id));
+    auto mloc = CreateMonster(fbb, nullptr, 150, static_cast<int16_t>(id),
+                              name, fbb.CreateVector(inventory));
+    FinishMonsterBuffer(fbb, mloc);
+    flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+    auto monster = GetMonster(fbb.GetBufferPointer());
+    if (!VerifyMonsterBuffer(verifier) || monster->hp() != id ||
+        monster->inventory()->size() != static_cast<size_t>(id % 37)) {
+      failures++;
+    }
+  };
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; t++) {
+    threads.push_back(std::thread([&, t]() {
+      for (int i = 0; i < iterations; i++) {
+        auto fbb = pool.Acquire();
+        build(*fbb, t * 1000 + i);
+        // Holding a second builder sends one of them through the shared
+        // slots when both are returned.
+        if (i % 2) {
+          auto fbb2 = pool.Acquire();
+          if (fbb2.get() == fbb.get()) failures++;
+          build(*fbb2, t * 1000 + i + 500);
+        }
+      }
+    }));
+  }
+  for (auto it = threads.begin(); it != threads.end(); ++it) it->join();
+  TEST_EQ(failures.load(), 0);
+}
+
+void ArenaAllocatorTest() {
+  flatbuffers::FlatBufferBuilder reference;
+  CreateManyMonsters(reference, 100);
+
+  CountingAllocator upstream;
+  {
+    // Everything fits in the caller supplied region.
+    std::vector<uint8_t> region(256 * 1024);
+    flatbuffers::ArenaAllocator arena(region.data(), region.size(), 64 * 1024,
+                                      &upstream);
+    for (int i = 0; i < 3; i++) {
+      {
+        flatbuffers::DetachedBuffer buf;
+        {
+          flatbuffers::FlatBufferBuilder fbb(1024, &arena);
+          CreateManyMonsters(fbb, 100);
+          buf = fbb.Release();
+        }
+        TEST_EQ(buf.size(), reference.GetSize());
+        TEST_EQ(memcmp(buf.data(), reference.GetBufferPointer(), buf.size()),
+                0);
+        flatbuffers::Verifier verifier(buf.data(), buf.size());
+        TEST_EQ(VerifyMonsterBuffer(verifier), true);
+      }
+      arena.Reset();
+    }
+    TEST_EQ(upstream.allocations, 0);
+  }
+  {
+    // Without a region, blocks are allocated as needed. The buffer grows in
+    // place, so it needs no more than a single block.
+    flatbuffers::ArenaAllocator arena(256 * 1024, &upstream);
+    flatbuffers::FlatBufferBuilder fbb(1024, &arena);
+    CreateManyMonsters(fbb, 100);
+    TEST_EQ(upstream.allocations, 1);
+    TEST_EQ(memcmp(fbb.GetBufferPointer(), reference.GetBufferPointer(),
+                   fbb.GetSize()), 0);
+    // Until it doesn't fit anymore.
+    fbb.Clear();
+    CreateManyMonsters(fbb, 10000);
+    TEST_EQ(upstream.allocations > 1, true);
+    flatbuffers::Verifier verifier(fbb.GetBufferPointer(), fbb.GetSize());
+    TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  }
+  TEST_EQ(upstream.allocations, upstream.deallocations);
+}
+
+// Builds a small buffer using nothing but builder calls, so any allocation
+// made while doing this comes from the builder.
+void CreateFixedMonster(flatbuffers::FlatBufferBuilder &builder, int16_t hp) {
+  static const uint8_t inventory[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+  auto pos = Vec3(1, 2, 3, 0, Color_Red, Test(10, 20));
+  flatbuffers::Offset<Monster> children[2];
+  for (int i = 0; i < 2; i++) {
+    children[i] = CreateMonster(builder, &pos, 150, hp,
+                                builder.CreateSharedString("child"),
+                                builder.CreateVector(inventory, 5));
+  }
+  auto root = CreateMonster(builder, &pos, 150, hp,
+                            builder.CreateString("root"),
+                            builder.CreateVector(inventory, 10), Color_Blue,
+                            Any_NONE, 0, 0, 0,
+                            builder.CreateVector(children, 2));
+  FinishMonsterBuffer(builder, root);
+}
+
+// Counts calls of the global operator new while count_global_allocations is
+// set, to check code that shouldn't allocate at all, rather than just through
+// its Allocator. The other forms of new and delete call these.
+bool count_global_allocations = false;
+int global_allocations = 0;
+
+#if defined(__GNUC__) || defined(__clang__)
+  // Inlined, GCC would warn about free() on memory from new.
+  #define TEST_NOINLINE __attribute__((noinline))
+#else
+  #define TEST_NOINLINE
+#endif
+
+TEST_NOINLINE void *operator new(size_t size) {
+  if (count_global_allocations) global_allocations++;
+  auto p = malloc(size ? size : 1);
+  if (!p) throw std::bad_alloc();
+  return p;
+}
+
+TEST_NOINLINE void operator delete(void *p) noexcept { free(p); }
+
+void FixedBufferTest() {
+  flatbuffers::FlatBufferBuilder reference;
+  CreateFixedMonster(reference, 80);
+
+  // Keep the end of the buffer aligned.
+  uint64_t storage[128];
+  auto buf = reinterpret_cast<uint8_t *>(storage);
+  CountingAllocator allocator;
+  flatbuffers::FlatBufferBuilder fbb(1024, &allocator);
+  fbb.UseFixedBuffer(buf, sizeof(storage), 16, 8, 8);
+  // Building doesn't allocate, through the allocator or otherwise (e.g. for
+  // the scratch space of tables, or the indices of vtables and strings).
+  bool same = true;
+  global_allocations = 0;
+  count_global_allocations = true;
+  for (int i = 0; i < 100; i++) {
+    fbb.Clear();
+    CreateFixedMonster(fbb, 80);
+    same = same && !fbb.IsOutOfSpace() &&
+           fbb.GetSize() == reference.GetSize() &&
+           !memcmp(fbb.GetBufferPointer(), reference.GetBufferPointer(),
+                   fbb.GetSize());
+  }
+  count_global_allocations = false;
+  TEST_EQ(global_allocations, 0);
+  TEST_EQ(allocator.allocations, 0);
+  TEST_EQ(same, true);
+  TEST_EQ(fbb.GetBufferPointer() + fbb.GetSize(), buf + sizeof(storage));
+  auto detached = fbb.Release();
+  TEST_EQ(detached.data(), fbb.GetBufferPointer());
+  flatbuffers::Verifier verifier(detached.data(), detached.size());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  TEST_EQ(GetMonster(detached.data())->testarrayoftables()->Get(1)->hp(), 80);
+
+  // Running out of space is reported, not fatal, and doesn't allocate
+  // either: writes that don't fit are dropped.
+  flatbuffers::FlatBufferBuilder small(1024, &allocator);
+  small.UseFixedBuffer(buf, 64);
+  CreateFixedMonster(small, 80);
+  TEST_EQ(small.IsOutOfSpace(), true);
+  TEST_EQ(small.GetSize() <= 64, true);
+  std::vector<uint8_t> big(1000, 1);
+  small.CreateVector(big);
+  uint8_t *uninitialized = buf;
+  small.CreateUninitializedVector(1000, 1, &uninitialized);
+  TEST_EQ(uninitialized, static_cast<uint8_t *>(nullptr));
+  TEST_EQ(small.GetSize() <= 64, true);
+  TEST_EQ(allocator.allocations, 0);
+  small.Clear();
+  TEST_EQ(small.IsOutOfSpace(), false);
+  // So is running out of space for fields.
+  small.UseFixedBuffer(buf, sizeof(storage), 2);
+  CreateFixedMonster(small, 80);
+  TEST_EQ(small.IsOutOfSpace(), true);
+  // Reset() goes back to allocating as needed.
+  small.Reset();
+  CreateFixedMonster(small, 80);
+  TEST_EQ(small.IsOutOfSpace(), false);
+  TEST_EQ(small.GetSize(), reference.GetSize());
+}
+
+void SpliceTest() {
+  // Each part is built by a separate builder (as if on separate threads),
+  // the first one using segments.
+  const int num_parts = 4;
+  flatbuffers::FlatBufferBuilder parts[num_parts];
+  flatbuffers::Offset<Monster> part_roots[num_parts];
+  parts[0].UseSegments(64);
+  for (int i = 0; i < num_parts; i++) {
+    auto &part = parts[i];
+    std::vector<flatbuffers::Offset<Monster>> children;
+    for (int j = 0; j < 10; j++) {
+      auto pos = Vec3(1, 2, static_cast<float>(j), 0, Color_Red, Test(10, 20));
+      children.push_back(CreateMonster(part, &pos, 150,
+                                       static_cast<int16_t>(i * 100 + j),
+                                       part.CreateSharedString("child")));
+    }
+    part_roots[i] = CreateMonster(part, nullptr, 150,
+                                  static_cast<int16_t>(i),
+                                  part.CreateSharedString("part"), 0,
+                                  Color_Blue, Any_NONE, 0, 0, 0,
+                                  part.CreateVector(children));
+  }
+
+  flatbuffers::FlatBufferBuilder builder;
+  builder.CreateString("padding");  // So offsets differ from the parts.
+  std::vector<flatbuffers::Offset<Monster>> spliced;
+  for (int i = 0; i < num_parts; i++) {
+    spliced.push_back(builder.Splice(parts[i], part_roots[i]));
+  }
+  // Shared strings and vtables from the parts are reused by the builder.
+  auto size = builder.GetSize();
+  TEST_EQ(builder.CreateSharedString("child").o <= size, true);
+  auto pos = Vec3(1, 2, 3, 0, Color_Red, Test(10, 20));
+  auto name = builder.CreateSharedString("part");
+  TEST_EQ(name.o <= size, true);
+  size = builder.GetSize();
+  auto extra = CreateMonster(builder, &pos, 150, 7, name);
+  // Only the table itself was added, without a vtable.
+  TEST_EQ(builder.GetSize() - size < 48, true);
+  spliced.push_back(extra);
+  auto root = CreateMonster(builder, nullptr, 150, 100,
+                            builder.CreateString("root"), 0, Color_Blue,
+                            Any_NONE, 0, 0, 0, builder.CreateVector(spliced));
+  FinishMonsterBuffer(builder, root);
+
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  auto monsters = GetMonster(builder.GetBufferPointer())->testarrayoftables();
+  TEST_EQ(monsters->size(), static_cast<flatbuffers::uoffset_t>(num_parts + 1));
+  for (int i = 0; i < num_parts; i++) {
+    auto part = monsters->Get(i);
+    TEST_EQ(part->hp(), i);
+    TEST_EQ_STR(part->name()->c_str(), "part");
+    TEST_EQ(part->testarrayoftables()->size(), 10U);
+    auto child = part->testarrayoftables()->Get(3);
+    TEST_EQ(child->hp(), i * 100 + 3);
+    TEST_EQ(child->pos()->z(), 3);
+    TEST_EQ_STR(child->name()->c_str(), "child");
+  }
+  TEST_EQ(monsters->Get(num_parts)->hp(), 7);
+  TEST_EQ_STR(monsters->Get(num_parts)->name()->c_str(), "part");
+}
+
+void DenseCreateTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Stat>> stats;
+  for (int i = 0; i < 3; i++) {
+    stats.push_back(CreateStatDense(builder,
+                                    builder.CreateString(
+                                      flatbuffers::NumToString(i)),
+                                    i, static_cast<uint16_t>(i * 2)));
+  }
+  // The generic path gives the same layout when starting from the same
+  // alignment with all fields set, so it shares the vtable.
+  auto id = builder.CreateString("generic");
+  builder.ForceDefaults(true);
+  builder.Align(8);
+  stats.push_back(CreateStat(builder, id, 0, 5));
+  builder.ForceDefaults(false);
+  auto simple = CreateTestSimpleTableWithEnumDense(builder, Color_Red);
+  auto root = CreateMonster(builder, nullptr, 150, 80,
+                            builder.CreateString("dense"), 0, Color_Blue,
+                            Any_TestSimpleTableWithEnum, simple.Union(), 0, 0,
+                            0, 0, 0, stats[1]);
+  FinishMonsterBuffer(builder, root);
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+
+  auto eob = builder.GetBufferPointer() + builder.GetSize();
+  std::set<const uint8_t *> vtables;
+  for (size_t i = 0; i < stats.size(); i++) {
+    auto stat = reinterpret_cast<const Stat *>(eob - stats[i].o);
+    auto table = reinterpret_cast<const flatbuffers::Table *>(stat);
+    vtables.insert(table->GetVTable());
+    TEST_EQ(stat->val(), static_cast<int64_t>(i < 3 ? i : 0));
+    TEST_EQ(stat->count(), i < 3 ? i * 2 : 5);
+    // Even fields equal to their default are present.
+    TEST_EQ(table->CheckField(Stat::VT_VAL), true);
+  }
+  TEST_EQ(vtables.size(), 1U);
+  auto monster = GetMonster(builder.GetBufferPointer());
+  TEST_EQ_STR(monster->testempty()->id()->c_str(), "1");
+  TEST_EQ(monster->test_as_TestSimpleTableWithEnum()->color(), Color_Red);
+
+  // Unions with a NONE type are left out, which needs a vtable computed at
+  // runtime, that is still shared between tables.
+  flatbuffers::FlatBufferBuilder fbb;
+  auto enemy = CreateMonster(fbb, nullptr, 150, 100, fbb.CreateString("foe"));
+  auto pos = Vec3(1, 2, 3, 0, Color_Red, Test(1, 2));
+  std::vector<uint8_t> no_bytes;
+  std::vector<flatbuffers::Offset<flatbuffers::String>> no_strings;
+  std::vector<flatbuffers::Offset<Monster>> no_monsters;
+  std::vector<Test> no_tests;
+  std::vector<Ability> no_abilities;
+  std::vector<int64_t> no_longs;
+  std::vector<double> no_doubles;
+  std::vector<flatbuffers::Offset<Monster>> dense;
+  for (int i = 0; i < 3; i++) {
+    auto any_type = i == 2 ? Any_TestSimpleTableWithEnum : Any_NONE;
+    auto any = i == 2
+      ? CreateTestSimpleTableWithEnumDense(fbb, Color_Red).Union()
+      : flatbuffers::Offset<void>();
+    dense.push_back(CreateMonsterDense(fbb, &pos, 150,
+      static_cast<int16_t>(i), fbb.CreateString("dense"),
+      fbb.CreateVector(no_bytes), Color_Blue, any_type, any,
+      fbb.CreateVectorOfStructs(no_tests), fbb.CreateVector(no_strings),
+      fbb.CreateVector(no_monsters), enemy, fbb.CreateVector(no_bytes),
+      CreateStatDense(fbb, fbb.CreateString("stat"), 0, 0), false,
+      0, 0, 0, 0, 0, 0, 0, 0, fbb.CreateVector(no_bytes), 3.14159f, 3.0f,
+      0.0f, fbb.CreateVector(no_strings),
+      fbb.CreateVectorOfStructs(no_abilities), fbb.CreateVector(no_bytes),
+      fbb.CreateVectorOfStructs(no_tests), fbb.CreateVector(no_longs),
+      fbb.CreateVector(no_doubles), MyGame::CreateInParentNamespace(fbb)));
+  }
+  FinishMonsterBuffer(fbb, CreateMonster(fbb, nullptr, 150, 100,
+                                         fbb.CreateString("root"), 0,
+                                         Color_Blue, Any_NONE, 0, 0, 0,
+                                         fbb.CreateVector(dense)));
+  flatbuffers::Verifier dense_verifier(fbb.GetBufferPointer(), fbb.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(dense_verifier), true);
+  auto dense_monsters =
+    GetMonster(fbb.GetBufferPointer())->testarrayoftables();
+  vtables.clear();
+  for (flatbuffers::uoffset_t i = 0; i < dense_monsters->size(); i++) {
+    auto m = dense_monsters->Get(i);
+    auto table = reinterpret_cast<const flatbuffers::Table *>(m);
+    vtables.insert(table->GetVTable());
+    TEST_EQ(m->hp(), static_cast<int16_t>(i));
+    TEST_EQ_STR(m->enemy()->name()->c_str(), "foe");
+    TEST_EQ(table->CheckField(Monster::VT_TEST), i == 2);
+  }
+  TEST_EQ(vtables.size(), 2U);
+  TEST_EQ(dense_monsters->Get(2)->test_as_TestSimpleTableWithEnum()->color(),
+          Color_Red);
+}
+
+// Builds monsters with many repeated children.
+flatbuffers::Offset<Monster> CreateRepetitiveMonster(
+    flatbuffers::FlatBufferBuilder &builder, bool shared) {
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 50; i++) {
+    std::vector<flatbuffers::Offset<Monster>> children;
+    for (int j = 0; j < 4; j++) {
+      auto pos = Vec3(1, 2, static_cast<float>(j), 0, Color_Red, Test(1, 2));
+      std::vector<uint8_t> inventory(10, static_cast<uint8_t>(j));
+      auto name = builder.CreateSharedString(
+        "child" + flatbuffers::NumToString(j));
+      children.push_back(CreateMonster(builder, &pos, 150,
+                                       static_cast<int16_t>(j), name,
+        shared ? builder.CreateSharedVector(inventory)
+               : builder.CreateVector(inventory)));
+    }
+    monsters.push_back(CreateMonster(builder, nullptr, 150,
+                                     static_cast<int16_t>(i % 3),
+                                     builder.CreateSharedString("parent"), 0,
+                                     Color_Blue, Any_NONE, 0, 0, 0,
+      shared ? builder.CreateSharedVector(children)
+             : builder.CreateVector(children)));
+  }
+  return CreateMonster(builder, nullptr, 150, 100,
+                       builder.CreateString("root"), 0, Color_Blue, Any_NONE,
+                       0, 0, 0, builder.CreateVector(monsters));
+}
+
+void SharedObjectsTest() {
+  flatbuffers::FlatBufferBuilder reference;
+  FinishMonsterBuffer(reference, CreateRepetitiveMonster(reference, false));
+  flatbuffers::FlatBufferBuilder builder;
+  builder.DedupTables(true);
+  // Vec3 is aligned to 16, so that all children get the same layout.
+  builder.Align(16);
+  FinishMonsterBuffer(builder, CreateRepetitiveMonster(builder, true));
+  TEST_EQ(builder.GetSize() * 4 < reference.GetSize(), true);
+  TEST_EQ(builder.GetSharedBytesSaved() > reference.GetSize() / 2, true);
+
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  auto monsters = GetMonster(builder.GetBufferPointer())->testarrayoftables();
+  auto ref_monsters =
+    GetMonster(reference.GetBufferPointer())->testarrayoftables();
+  TEST_EQ(monsters->size(), ref_monsters->size());
+  for (flatbuffers::uoffset_t i = 0; i < monsters->size(); i++) {
+    auto children = monsters->Get(i)->testarrayoftables();
+    auto ref_children = ref_monsters->Get(i)->testarrayoftables();
+    TEST_EQ(monsters->Get(i)->hp(), ref_monsters->Get(i)->hp());
+    TEST_EQ(children->size(), ref_children->size());
+    for (flatbuffers::uoffset_t j = 0; j < children->size(); j++) {
+      TEST_EQ(children->Get(j)->hp(), ref_children->Get(j)->hp());
+      TEST_EQ(children->Get(j)->pos()->z(), ref_children->Get(j)->pos()->z());
+      TEST_EQ_STR(children->Get(j)->name()->c_str(),
+                  ref_children->Get(j)->name()->c_str());
+      TEST_EQ(children->Get(j)->inventory()->Get(9),
+              ref_children->Get(j)->inventory()->Get(9));
+    }
+    // Identical parents (and so their children) are stored once.
+    TEST_EQ(monsters->Get(i) == monsters->Get(i % 3), true);
+  }
+  builder.Clear();
+  TEST_EQ(builder.GetSharedBytesSaved(), 0U);
+
+  // Tables whose offset fields have the same value, but refer to different
+  // objects, are not the same.
+  auto a = builder.CreateString("a");
+  auto monster_a = CreateMonster(builder, nullptr, 150, 100, a);
+  auto b = builder.CreateString("b");
+  auto monster_b = CreateMonster(builder, nullptr, 150, 100, b);
+  TEST_EQ(monster_a.o != monster_b.o, true);
+  auto monster_a2 = CreateMonster(builder, nullptr, 150, 100, a);
+  TEST_EQ(monster_a2.o, monster_a.o);
+
+  // Tables are only padded to the alignment the buffer already has.
+  flatbuffers::FlatBufferBuilder plain;
+  builder.Clear();
+  for (int i = 0; i < 10; i++) {
+    CreateMonster(plain, nullptr, 150, static_cast<int16_t>(i),
+                  plain.CreateString("m"));
+    CreateMonster(builder, nullptr, 150, static_cast<int16_t>(i),
+                  builder.CreateString("m"));
+  }
+  TEST_EQ(builder.GetSize(), plain.GetSize());
+}
+
+void VerifierMemoizeTest() {
+  // A chain of monsters that each refer to the previous one three times, so
+  // verifying every reference would visit 3^30 tables.
+  flatbuffers::FlatBufferBuilder builder;
+  auto name = builder.CreateString("Shared");
+  auto monster = CreateMonster(builder, nullptr, 100, 150, name);
+  for (int i = 0; i < 30; i++) {
+    flatbuffers::Offset<Monster> children[] = { monster, monster };
+    auto vec = builder.CreateVector(children, 2);
+    monster = CreateMonster(builder, nullptr, 100, 150, name, 0, Color_Blue,
+                            Any_NONE, 0, 0, 0, vec, monster);
+  }
+  FinishMonsterBuffer(builder, monster);
+
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(), builder.GetSize(),
+                                 64, 31);
+  verifier.Memoize(true);
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+
+  // A table read as two different types is verified as each.
+  flatbuffers::Verifier typed(builder.GetBufferPointer(), builder.GetSize());
+  typed.Memoize(true);
+  auto root = GetMonster(builder.GetBufferPointer());
+  auto monster_id = flatbuffers::Verifier::MemoTypeId<Monster>();
+  auto stat_id = flatbuffers::Verifier::MemoTypeId<Stat>();
+  TEST_EQ(monster_id != 0, true);
+  TEST_EQ(monster_id == stat_id, false);
+  TEST_EQ(monster_id, flatbuffers::Verifier::MemoTypeId<Monster>());
+  TEST_EQ(typed.NeedsVerification(root, monster_id), true);
+  typed.MarkVerified(root, monster_id);
+  TEST_EQ(typed.NeedsVerification(root, monster_id), false);
+  TEST_EQ(typed.NeedsVerification(root, stat_id), true);
+  typed.MarkVerified(root, stat_id);
+  TEST_EQ(typed.NeedsVerification(root, stat_id), true);
+
+  // Objects that fail verification aren't remembered, so fail every time.
+  flatbuffers::FlatBufferBuilder strings_builder;
+  auto strings = strings_builder.CreateVectorOfStrings({ "a", "b" });
+  FinishMonsterBuffer(strings_builder,
+                      CreateMonster(strings_builder, nullptr, 100, 150,
+                                    strings_builder.CreateString("Strings"),
+                                    0, Color_Blue, Any_NONE, 0, 0, strings));
+  std::vector<uint8_t> corrupt(strings_builder.GetBufferPointer(),
+                               strings_builder.GetBufferPointer() +
+                               strings_builder.GetSize());
+  auto vec = GetMutableMonster(corrupt.data())->mutable_testarrayofstring();
+  auto str = vec->GetMutableObject(1);
+  flatbuffers::WriteScalar<flatbuffers::uoffset_t>(str, 0x7FFFFFF0);
+  flatbuffers::Verifier corrupt_verifier(corrupt.data(), corrupt.size());
+  corrupt_verifier.Memoize(true);
+  corrupt_verifier.ExpectFailures(true);
+  TEST_EQ(corrupt_verifier.VerifyVectorOfStrings(vec), false);
+  TEST_EQ(corrupt_verifier.VerifyVectorOfStrings(vec), false);
+  TEST_EQ(VerifyMonsterBuffer(corrupt_verifier), false);
+  TEST_EQ(VerifyMonsterBuffer(corrupt_verifier), false);
+
+  // The same through a LazyVerifier, which memoizes too.
+  flatbuffers::LazyVerifier lazy(corrupt.data(), corrupt.size());
+  auto checked = GetCheckedMonster(lazy);
+  TEST_EQ(checked.testarrayofstring(),
+          static_cast<const flatbuffers::Vector<
+            flatbuffers::Offset<flatbuffers::String>> *>(nullptr));
+  TEST_EQ(checked.testarrayofstring(),
+          static_cast<const flatbuffers::Vector<
+            flatbuffers::Offset<flatbuffers::String>> *>(nullptr));
+  TEST_EQ(lazy.ok(), false);
+}
+
+void ParallelVerifierTest() {
+  // Large vectors of tables and strings, with a few nested vectors that are
+  // large enough to split as well.
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  std::vector<flatbuffers::Offset<flatbuffers::String>> names;
+  for (int i = 0; i < 500; i++) {
+    auto name = builder.CreateString("monster" + flatbuffers::NumToString(i));
+    names.push_back(name);
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Monster>>>
+      children = 0;
+    if (i % 100 == 0) children = builder.CreateVector(monsters);
+    monsters.push_back(CreateMonster(builder, nullptr, 100, 150, name, 0,
+                                     Color_Blue, Any_NONE, 0, 0, 0,
+                                     children));
+  }
+  auto vec_of_tables = builder.CreateVector(monsters);
+  auto vec_of_strings = builder.CreateVector(names);
+  FinishMonsterBuffer(builder, CreateMonster(builder, nullptr, 100, 150,
+                                             builder.CreateString("root"), 0,
+                                             Color_Blue, Any_NONE, 0, 0,
+                                             vec_of_strings, vec_of_tables));
+
+  // The number of tables verified (shared ones once per reference), which
+  // the chunks have to stay within between them.
+  const flatbuffers::uoffset_t num_tables = 3101;
+  flatbuffers::Verifier serial(builder.GetBufferPointer(), builder.GetSize(),
+                               64, num_tables);
+  TEST_EQ(VerifyMonsterBuffer(serial), true);
+
+  flatbuffers::ThreadPool pool(4);
+  TEST_EQ(pool.size(), 4);
+  for (int memoize = 0; memoize < 2; memoize++) {
+    flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                   builder.GetSize(), 64, num_tables);
+    verifier.Memoize(memoize != 0);
+    verifier.Parallelize(&pool, 64);
+    TEST_EQ(VerifyMonsterBuffer(verifier), true);
+    TEST_EQ(verifier.GetComputedSize(), serial.GetComputedSize());
+  }
+
+  // With memoization, each of the 501 tables is verified once, in parallel
+  // or not.
+  const flatbuffers::uoffset_t num_memoized = 501;
+  flatbuffers::Verifier memoized(builder.GetBufferPointer(), builder.GetSize(),
+                                 64, num_memoized);
+  memoized.Memoize(true);
+  TEST_EQ(VerifyMonsterBuffer(memoized), true);
+  flatbuffers::Verifier parallel(builder.GetBufferPointer(), builder.GetSize(),
+                                 64, num_memoized);
+  parallel.Memoize(true);
+  parallel.Parallelize(&pool, 64);
+  TEST_EQ(VerifyMonsterBuffer(parallel), true);
+  TEST_EQ(parallel.GetComputedSize(), memoized.GetComputedSize());
+
+  #ifdef FLATBUFFERS_VERIFIER_MAX_BYTES
+  // The chunks share the byte budget as well: the smallest one that
+  // suffices is the same as when verifying serially.
+  auto min_budget = [&](bool parallelize) {
+    size_t lo = 0;
+    size_t hi = static_cast<size_t>(-2);
+    while (lo < hi) {
+      auto mid = lo + (hi - lo) / 2;
+      flatbuffers::Verifier v(builder.GetBufferPointer(), builder.GetSize(),
+                              64, num_tables);
+      v.ExpectFailures(true);
+      v.SetMaxBytes(mid);
+      if (parallelize) v.Parallelize(&pool, 64);
+      if (VerifyMonsterBuffer(v)) {
+        hi = mid;
+      } else {
+        lo = mid + 1;
+      }
+    }
+    return lo;
+  };
+  auto serial_budget = min_budget(false);
+  TEST_EQ(serial_budget > builder.GetSize(), true);
+  TEST_EQ(min_budget(true), serial_budget);
+  #endif
+}
+
+void IncrementalVerifierTest(bool dedup_vtables) {
+  flatbuffers::FlatBufferBuilder builder;
+  // Shared vtables are at the end of the buffer, so hold up verification of
+  // all tables using them until it is complete.
+  builder.DedupVtables(dedup_vtables);
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 100; i++) {
+    auto name = builder.CreateString("monster" + flatbuffers::NumToString(i));
+    flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<Monster>>>
+      children = 0;
+    if (i % 10 == 0) children = builder.CreateVector(monsters);
+    monsters.push_back(CreateMonster(builder, nullptr, 100, 150, name, 0,
+                                     Color_Blue, Any_NONE, 0, 0, 0,
+                                     children));
+  }
+  auto vec_of_tables = builder.CreateVector(monsters);
+  builder.FinishSizePrefixed(CreateMonster(builder, nullptr, 100, 150,
+                                           builder.CreateString("root"), 0,
+                                           Color_Blue, Any_NONE, 0, 0, 0,
+                                           vec_of_tables),
+                             MonsterIdentifier());
+  auto data = builder.GetBufferPointer();
+  size_t size = builder.GetSize();
+
+  size_t chunk_sizes[] = { 1, 2, size };
+  for (size_t c = 0; c < sizeof(chunk_sizes) / sizeof(*chunk_sizes); c++) {
+    flatbuffers::IncrementalVerifier<Monster> verifier(MonsterIdentifier());
+    // The buffer grows (and moves) as chunks arrive.
+    std::vector<uint8_t> buf;
+    while (buf.size() < size) {
+      auto end = std::min(size, buf.size() + chunk_sizes[c]);
+      buf.insert(buf.end(), data + buf.size(), data + end);
+      TEST_EQ(verifier.done(), false);
+      TEST_EQ(verifier.Update(buf.data(), buf.size()), true);
+      if (buf.size() >= sizeof(flatbuffers::uoffset_t)) {
+        TEST_EQ(verifier.size(), size);
+      }
+      if (buf.size() == size / 2 && !dedup_vtables) {
+        // About half of the monsters are left.
+        TEST_EQ(verifier.pending() > 25 && verifier.pending() < 75, true);
+      }
+    }
+    TEST_EQ(verifier.done(), true);
+    TEST_EQ(verifier.pending(), 0);
+  }
+}
+
+void BuilderStatsTest() {
+  #ifdef FLATBUFFERS_BUILDER_STATS
+    flatbuffers::FlatBufferBuilder builder(64);
+    CreateManyMonsters(builder, 200);
+    auto stats = builder.GetStats();
+    TEST_EQ(stats.reallocations > 0, true);
+    TEST_EQ(stats.bytes_copied > 0, true);
+    TEST_EQ(stats.padding_bytes > 0, true);
+    // All monsters but the root share a vtable, except those without an
+    // inventory or hp.
+    TEST_EQ(stats.vtables_created + stats.vtables_deduped, 201U);
+    TEST_EQ(stats.vtables_created < 10, true);
+    // CreateManyMonsters shares 100 distinct names.
+    TEST_EQ(stats.string_pool_misses, 100U);
+    TEST_EQ(stats.string_pool_hits, 100U);
+    TEST_EQ(stats.peak_fields, 4U);  // pos, hp, name and inventory.
+
+    // Counters are per buffer, and a warm builder doesn't grow.
+    builder.Clear();
+    TEST_EQ(builder.GetStats().string_pool_hits, 0U);
+    CreateManyMonsters(builder, 200);
+    stats = builder.GetStats();
+    TEST_EQ(stats.reallocations, 0U);
+    TEST_EQ(stats.bytes_copied, 0U);
+    TEST_EQ(stats.string_pool_hits, 100U);
+  #endif
+}
+
+void VerifierStatsTest(const uint8_t *flatbuf, size_t length) {
+  #ifdef FLATBUFFERS_VERIFIER_STATS
+    flatbuffers::Verifier verifier(flatbuf, length);
+    verifier.StatsPerType(true);
+    TEST_EQ(VerifyMonsterBuffer(verifier), true);
+    auto &stats = verifier.GetStats();
+    TEST_EQ(stats.tables, 5U);  // The root, 3 in a vector and 1 in a union.
+    TEST_EQ(stats.max_depth, 2U);
+    TEST_EQ(stats.vectors, 9U);
+    TEST_EQ(stats.strings, 11U);
+    // All bytes but the root offset are checked within a table.
+    TEST_EQ(stats.types.size(), 1U);
+    TEST_EQ_STR(stats.types[0].name, "MyGame.Example.Monster");
+    TEST_EQ(stats.types[0].tables, 5U);
+    TEST_EQ(stats.types[0].bytes + sizeof(flatbuffers::uoffset_t),
+            stats.bytes);
+
+    #ifdef FLATBUFFERS_VERIFIER_MAX_BYTES
+      // A byte budget of exactly what it takes, and one byte less.
+      flatbuffers::Verifier budget(flatbuf, length);
+      budget.SetMaxBytes(stats.bytes);
+      TEST_EQ(VerifyMonsterBuffer(budget), true);
+      TEST_EQ(budget.GetStats().types.size(), 0U);  // Not asked for.
+      flatbuffers::Verifier short_budget(flatbuf, length);
+      short_budget.ExpectFailures(true);
+      short_budget.SetMaxBytes(stats.bytes - 1);
+      TEST_EQ(VerifyMonsterBuffer(short_budget), false);
+    #endif
+  #else
+    (void)flatbuf;
+    (void)length;
+  #endif
+}
+
+// Vectors of strings are checked all at once, which must have the same
+// outcome as checking the strings one by one.
+void VectorOfStringsVerifierTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<flatbuffers::String>> strings;
+  std::string str;
+  for (int i = 0; i < 1003; i++) {
+    str.assign(static_cast<size_t>(i % 37), static_cast<char>('a' + i % 26));
+    strings.push_back(i % 5 ? builder.CreateString(str)
+                            : builder.CreateSharedString(str));
+  }
+  auto vec = builder.CreateVector(strings);
+  auto name = builder.CreateString("Strings");
+  MonsterBuilder monster(builder);
+  monster.add_name(name);
+  monster.add_testarrayofstring(vec);
+  FinishMonsterBuffer(builder, monster.Finish());
+
+  auto buf = builder.GetBufferPointer();
+  auto size = builder.GetSize();
+  flatbuffers::Verifier verifier(buf, size);
+  TEST_EQ(VerifyMonsterBuffer(verifier), true);
+  TEST_EQ(verifier.GetComputedSize(), size);
+
+  auto array = GetMonster(buf)->testarrayofstring();
+  TEST_EQ(array->size(), 1003U);
+  flatbuffers::Verifier all(buf, size);
+  TEST_EQ(all.Verify(array), true);
+  TEST_EQ(all.VerifyVectorOfStrings(array), true);
+  flatbuffers::Verifier one_by_one(buf, size);
+  TEST_EQ(one_by_one.Verify(array), true);
+  for (flatbuffers::uoffset_t i = 0; i < array->size(); i++) {
+    TEST_EQ(one_by_one.Verify(array->Get(i)), true);
+  }
+  TEST_EQ(all.GetComputedSize(), one_by_one.GetComputedSize());
+  #ifdef FLATBUFFERS_VERIFIER_STATS
+    TEST_EQ(all.GetStats().strings, 1003U);
+    TEST_EQ(all.GetStats().bytes, one_by_one.GetStats().bytes);
+  #endif
+}
+
+void EytzingerTest() {
+  for (uint32_t n = 0; n < 40; n++) {
+    flatbuffers::FlatBufferBuilder builder;
+    std::vector<flatbuffers::Offset<Monster>> monsters;
+    std::vector<Ability> abilities;
+    // Even keys in descending order, so odd keys can be looked up and fail.
+    for (uint32_t i = 0; i < n; i++) {
+      auto key = 2 * (n - 1 - i);
+      auto name = builder.CreateString(flatbuffers::NumToString(1000 + key));
+      MonsterBuilder mb(builder);
+      mb.add_name(name);
+      monsters.push_back(mb.Finish());
+      abilities.push_back(Ability(key, i));
+    }
+    auto mvec = builder.CreateVectorOfEytzingerTables(&monsters);
+    auto avec = builder.CreateVectorOfEytzingerStructs(&abilities);
+    auto name = builder.CreateString("root");
+    MonsterBuilder mb(builder);
+    mb.add_name(name);
+    mb.add_testarrayoftables(mvec);
+    mb.add_testarrayofsortedstruct(avec);
+    builder.Finish(mb.Finish());
+
+    auto root = GetMonster(builder.GetBufferPointer());
+    auto tables = root->testarrayoftables();
+    auto structs = root->testarrayofsortedstruct();
+    TEST_EQ(tables->size(), n);
+    for (uint32_t key = 0; key < 2 * n + 1; key++) {
+      auto monster = tables->LookupByKeyEytzinger(
+        flatbuffers::NumToString(1000 + key).c_str());
+      auto ability = structs->LookupByKeyEytzinger(key);
+      if (key & 1 || key >= 2 * n) {
+        TEST_EQ(monster, static_cast<const Monster *>(nullptr));
+        TEST_EQ(ability, static_cast<const Ability *>(nullptr));
+      } else {
+        TEST_EQ_STR(monster->name()->c_str(),
+                    flatbuffers::NumToString(1000 + key).c_str());
+        TEST_EQ(ability->id(), key);
+      }
+    }
+
+    // Sorted order is still available.
+    uint32_t count = 0;
+    for (auto i = flatbuffers::EytzingerFirst(n); i < n;
+         i = flatbuffers::EytzingerNext(i, n)) {
+      TEST_EQ(structs->Get(i)->id(), 2 * count);
+      count++;
+    }
+    TEST_EQ(count, n);
+  }
+
+  // The accessors generated for fields with the eytzinger attribute.
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<KeyIndex::Entry>> entries;
+  std::vector<KeyIndex::Point> points;
+  for (uint32_t i = 0; i < 20; i++) {
+    entries.push_back(KeyIndex::CreateEntry(builder,
+      builder.CreateString(flatbuffers::NumToString(2 * i)),
+      static_cast<int32_t>(i)));
+    points.push_back(KeyIndex::Point(2 * i, static_cast<float>(i)));
+  }
+  auto sorted = builder.CreateVectorOfEytzingerTables(&entries);
+  auto sorted_points = builder.CreateVectorOfEytzingerStructs(&points);
+  builder.Finish(KeyIndex::CreateIndex(builder, sorted, 0, 0, 0, 0,
+                                       sorted_points));
+  flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                 builder.GetSize());
+  TEST_EQ(KeyIndex::VerifyIndexBuffer(verifier), true);
+  auto index = KeyIndex::GetIndex(builder.GetBufferPointer());
+  for (uint32_t key = 0; key < 41; key++) {
+    auto key_str = flatbuffers::NumToString(key);
+    auto entry = index->sorted_by_key(key_str.c_str());
+    auto point = index->sorted_points_by_key(key);
+    if (key & 1 || key >= 40) {
+      TEST_EQ(entry, static_cast<const KeyIndex::Entry *>(nullptr));
+      TEST_EQ(point, static_cast<const KeyIndex::Point *>(nullptr));
+    } else {
+      TEST_EQ(entry->value(), static_cast<int32_t>(key / 2));
+      TEST_EQ(point->x(), static_cast<float>(key / 2));
+    }
+  }
+
+  // Elements of forward declared types are checked once they are known.
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("table X { Y:[Z] (eytzinger); } "
+                       "table Z { A:int (key); }"), true);
+}
+
+// Whether T has a KeyHash() member.
+template<typename T> struct HasKeyHash {
+  template<typename U> static char Check(decltype(&U::KeyHash));
+  template<typename U> static long Check(...);
+  static const bool value = sizeof(Check<T>(nullptr)) == 1;
+};
+
+void KeyHashIndexTest() {
+  using namespace KeyIndex;
+  for (uint32_t n = 0; n < 40; n++) {
+    flatbuffers::FlatBufferBuilder builder;
+    std::vector<flatbuffers::Offset<Entry>> entries;
+    std::vector<Point> points;
+    // Even keys only, so odd keys can be looked up and fail.
+    for (uint32_t i = 0; i < n; i++) {
+      entries.push_back(CreateEntry(builder,
+        builder.CreateString(flatbuffers::NumToString(2 * i)),
+        static_cast<int32_t>(i)));
+      points.push_back(Point(2 * i, static_cast<float>(i)));
+    }
+    auto evec = builder.CreateVectorOfSortedTables(&entries);
+    auto pvec = builder.CreateVectorOfSortedStructs(&points);
+    auto eindex = builder.CreateKeyHashIndex(evec);
+    auto pindex = builder.CreateKeyHashIndex(pvec);
+    builder.Finish(CreateIndex(builder, 0, evec, eindex, pvec, pindex));
+
+    // The generated verifier checks the indices as well.
+    flatbuffers::Verifier verifier(builder.GetBufferPointer(),
+                                   builder.GetSize());
+    TEST_EQ(VerifyIndexBuffer(verifier), true);
+    auto root = GetIndex(builder.GetBufferPointer());
+    TEST_EQ(root->entries_index()->size() >= 2 * n, true);
+    for (uint32_t key = 0; key < 2 * n + 1; key++) {
+      auto key_str = flatbuffers::NumToString(key);
+      auto entry = root->entries_by_key(key_str.c_str());
+      auto point = root->points_by_key(key);
+      if (key & 1 || key >= 2 * n) {
+        TEST_EQ(entry, static_cast<const Entry *>(nullptr));
+        TEST_EQ(point, static_cast<const Point *>(nullptr));
+      } else {
+        TEST_EQ_STR(entry->name()->c_str(), key_str.c_str());
+        TEST_EQ(entry->value(), static_cast<int32_t>(key / 2));
+        TEST_EQ(point->id(), key);
+      }
+      // Lookups without the index find the same.
+      TEST_EQ(root->entries()->LookupByKey(key_str.c_str()), entry);
+      TEST_EQ(root->points()->LookupByKey(key), point);
+    }
+  }
+
+  // Keys compare up to their first 0 byte, and hash the same way.
+  flatbuffers::FlatBufferBuilder nul_builder;
+  std::vector<flatbuffers::Offset<Entry>> nul_entries;
+  nul_entries.push_back(CreateEntry(nul_builder,
+                                    nul_builder.CreateString("ab\0c", 4), 1));
+  nul_entries.push_back(CreateEntry(nul_builder,
+                                    nul_builder.CreateString("x"), 2));
+  auto nul_vec = nul_builder.CreateVectorOfSortedTables(&nul_entries);
+  auto nul_index = nul_builder.CreateKeyHashIndex(nul_vec);
+  nul_builder.Finish(CreateIndex(nul_builder, 0, nul_vec, nul_index));
+  auto nul_root = GetIndex(nul_builder.GetBufferPointer());
+  auto nul_entry = nul_root->entries()->LookupByKey("ab");
+  TEST_NOTNULL(nul_entry);
+  TEST_EQ(nul_entry->value(), 1);
+  TEST_EQ(nul_root->entries_by_key("ab"), nul_entry);
+
+  // Only types a hash_index refers to get KeyHash().
+  TEST_EQ(HasKeyHash<KeyIndex::Entry>::value, true);
+  TEST_EQ(HasKeyHash<KeyIndex::Point>::value, true);
+  TEST_EQ(HasKeyHash<KeyIndex::Plain>::value, false);
+  TEST_EQ(HasKeyHash<Monster>::value, false);
+
+  flatbuffers::Parser parser;
+  TEST_EQ(parser.Parse("table X { I:[uint] (hash_index: \"Y\"); Y:[Z]; } "
+                       "table Z { A:string (key); }"), true);
+}
+
+void GatherTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  for (int i = 0; i < 100; i++) {
+    auto name = builder.CreateString("m");
+    MonsterBuilder mb(builder);
+    mb.add_name(name);
+    // Runs of tables with and without hp, and with a different vtable now
+    // and then.
+    if (i % 20 < 10) mb.add_hp(static_cast<int16_t>(i));
+    if (i % 7 == 0) mb.add_testbool(true);
+    monsters.push_back(mb.Finish());
+  }
+  auto vec = builder.CreateVector(monsters);
+  auto name = builder.CreateString("root");
+  MonsterBuilder mb(builder);
+  mb.add_name(name);
+  mb.add_testarrayoftables(vec);
+  builder.Finish(mb.Finish());
+
+  auto tables = GetMonster(builder.GetBufferPointer())->testarrayoftables();
+  std::vector<int16_t> hp(tables->size());
+  std::vector<uint8_t> testbool(tables->size());
+  Monster::gather_hp(*tables, flatbuffers::vector_data(hp));
+  Monster::gather_testbool(*tables, flatbuffers::vector_data(testbool));
+  for (flatbuffers::uoffset_t i = 0; i < tables->size(); i++) {
+    TEST_EQ(hp[i], tables->Get(i)->hp());
+    TEST_EQ(testbool[i] != 0, tables->Get(i)->testbool());
+  }
+}
+
+void PrefetchingIteratorTest() {
+  flatbuffers::FlatBufferBuilder builder;
+  std::vector<flatbuffers::Offset<Monster>> monsters;
+  std::vector<flatbuffers::Offset<flatbuffers::String>> strings;
+  for (int i = 0; i < 50; i++) {
+    auto name = builder.CreateString(flatbuffers::NumToString(i));
+    strings.push_back(name);
+    MonsterBuilder mb(builder);
+    mb.add_name(name);
+    mb.add_hp(static_cast<int16_t>(i));
+    monsters.push_back(mb.Finish());
+  }
+  auto mvec = builder.CreateVector(monsters);
+  auto svec = builder.CreateVector(strings);
+  auto name = builder.CreateString("root");
+  MonsterBuilder mb(builder);
+  mb.add_name(name);
+  mb.add_testarrayoftables(mvec);
+  mb.add_testarrayofstring(svec);
+  builder.Finish(mb.Finish());
+
+  auto root = GetMonster(builder.GetBufferPointer());
+  auto tables = root->testarrayoftables();
+  auto names = root->testarrayofstring();
+  // Distances from none to beyond the end visit the same elements.
+  for (flatbuffers::uoffset_t distance = 0; distance < 64; distance += 7) {
+    flatbuffers::uoffset_t i = 0;
+    for (auto monster : flatbuffers::Prefetching(*tables, distance)) {
+      TEST_EQ(monster, tables->Get(i));
+      i++;
+    }
+    TEST_EQ(i, tables->size());
+    i = 0;
+    for (auto str : flatbuffers::Prefetching(*names, distance)) {
+      TEST_EQ(str, names->Get(i));
+      i++;
+    }
+    TEST_EQ(i, names->size());
+  }
+  // Nothing is read from an empty vector, even to prefetch.
+  builder.Clear();
+  builder.Finish(builder.CreateVector(
+    std::vector<flatbuffers::Offset<flatbuffers::String>>()));
+  auto empty = flatbuffers::GetRoot<
+    flatbuffers::Vector<flatbuffers::Offset<flatbuffers::String>>>(
+      builder.GetBufferPointer());
+  int visited = 0;
+  for (auto str : flatbuffers::Prefetching(*empty)) {
+    (void)str;
+    visited++;
+  }
+  TEST_EQ(visited, 0);
+}
+
+void TableViewTest(const uint8_t *flatbuf) {
+  auto monster = GetMonster(flatbuf);
+  auto view = monster->view();
+  TEST_EQ(view.hp(), monster->hp());
+  TEST_EQ(view.mana(), monster->mana());  // Absent, so the default.
+  TEST_EQ(view.name(), monster->name());
+  TEST_EQ(view.pos(), monster->pos());
+  TEST_EQ(view.test_type(), monster->test_type());
+  TEST_EQ(view.test(), monster->test());
+  TEST_EQ(view.testarrayoftables(), monster->testarrayoftables());
+  TEST_EQ(view.testbool(), monster->testbool());
+  TEST_EQ(view.testf(), monster->testf());
+  TEST_EQ(view.enemy(), monster->enemy());
+
+  // Older data, with a vtable that doesn't reach the fields of the view.
+  flatbuffers::FlatBufferBuilder builder;
+  auto start = builder.StartTable();
+  builder.AddElement<int16_t>(Monster::VT_MANA, 10, 150);
+  builder.Finish(flatbuffers::Offset<Monster>(builder.EndTable(start)));
+  auto old_view = GetMonster(builder.GetBufferPointer())->view();
+  TEST_EQ(old_view.mana(), 10);
+  TEST_EQ(old_view.hp(), 100);
+  TEST_EQ(old_view.name(), static_cast<const flatbuffers::String *>(nullptr));
+}
+
+void LazyVerifierTest(const uint8_t *flatbuf, size_t length) {
+  flatbuffers::LazyVerifier lazy(flatbuf, length);
+  auto checked = GetCheckedMonster(lazy);
+  auto monster = GetMonster(flatbuf);
+  TEST_EQ(checked.present(), true);
+  TEST_EQ(checked.hp(), 80);
+  TEST_EQ(checked.mana(), 150);  // Absent, so the default.
+  TEST_EQ(checked.pos()->z(), 3);
+  TEST_EQ(checked.name(), monster->name());
+  TEST_EQ(checked.inventory()->size(), 10);
+  TEST_EQ(checked.testarrayofstring(), monster->testarrayofstring());
+  TEST_EQ(checked.test4(), monster->test4());
+
+  auto monsters = checked.testarrayoftables();
+  TEST_EQ(monsters.size(), 3);
+  TEST_EQ_STR(monsters.Get(2).name()->c_str(), "Wilma");
+  TEST_EQ(monsters.Get(0).hp(), 1000);  // Barney, sorted first.
+
+  TEST_EQ(checked.test_type(), Any_Monster);
+  TEST_EQ_STR(checked.test_as_Monster().name()->c_str(), "Fred");
+  TEST_EQ(checked.test_as_TestSimpleTableWithEnum().present(), false);
+
+  // Absent tables read as absent, with default fields.
+  TEST_EQ(checked.enemy().present(), false);
+  TEST_EQ(checked.enemy().hp(), 100);
+  TEST_EQ(checked.testempty().id(),
+          static_cast<const flatbuffers::String *>(nullptr));
+  TEST_EQ(checked.parent_namespace_test().present(), false);
+
+  TEST_EQ(lazy.ok(), true);
+
+  // A name pointing out of the buffer reads as absent, and from then on the
+  // verifier is no longer ok, even when reading valid fields.
+  std::vector<uint8_t> corrupt(flatbuf, flatbuf + length);
+  auto table = reinterpret_cast<flatbuffers::Table *>(
+    GetMutableMonster(corrupt.data()));
+  flatbuffers::WriteScalar<flatbuffers::uoffset_t>(
+    table->GetAddressOf(Monster::VT_NAME), 0x7FFFFFF0);
+  flatbuffers::LazyVerifier corrupt_lazy(corrupt.data(), corrupt.size());
+  auto corrupt_checked = GetCheckedMonster(corrupt_lazy);
+  TEST_EQ(corrupt_checked.hp(), 80);
+  TEST_EQ(corrupt_lazy.ok(), true);
+  TEST_EQ(corrupt_checked.name(),
+          static_cast<const flatbuffers::String *>(nullptr));
+  TEST_EQ(corrupt_lazy.ok(), false);
+  TEST_EQ(corrupt_checked.hp(), 80);
+  TEST_EQ(corrupt_checked.inventory()->size(), 10);
+  TEST_EQ(corrupt_lazy.ok(), false);
+
+  // Reading everything from a truncated buffer, held in memory of exactly
+  // its size, never reads past its end (checked with ASan). Whatever is cut
+  // off reads as absent, and makes the verifier not ok.
+  for (size_t size = 0; size < length; size += 7) {
+    std::vector<uint8_t> truncated(flatbuf, flatbuf + size);
+    flatbuffers::LazyVerifier truncated_lazy(truncated.data(), size);
+    auto m = GetCheckedMonster(truncated_lazy);
+    m.hp();
+    auto name = m.name();
+    if (name) TEST_EQ_STR(name->c_str(), "MyMonster");
+    auto children = m.testarrayoftables();
+    bool complete = m.present() && m.pos() && name && m.inventory() &&
+                    m.testarrayofstring() && children.size() == 3 &&
+                    m.test_as_Monster().name();
+    for (flatbuffers::uoffset_t i = 0; i < children.size(); i++) {
+      complete = children.Get(i).name() && complete;
+    }
+    if (!complete) TEST_EQ(truncated_lazy.ok(), false);
+  }
+}
+
+void SpanTest(const uint8_t *flatbuf) {
+  auto monster = GetMonster(flatbuf);
+
+  auto name = monster->name_view();
+  TEST_EQ(name.size(), 9);
+  TEST_EQ(name.data(), monster->name()->c_str());
+  TEST_EQ(name == flatbuffers::string_view("MyMonster"), true);
+  TEST_EQ(name < flatbuffers::string_view("MyMonsters"), true);
+  TEST_EQ_STR(std::string(name.data(), name.size()).c_str(), "MyMonster");
+
+  auto inventory = monster->inventory_span();
+  TEST_EQ(inventory.size(), 10);
+  TEST_EQ(inventory.data(), monster->inventory()->Data());
+  uint8_t i = 0;
+  for (auto it = inventory.begin(); it != inventory.end(); ++it) {
+    TEST_EQ(*it, i++);
+  }
+
+  auto test4 = monster->test4_span();
+  TEST_EQ(test4.size(), 2);
+  TEST_EQ(test4[0].a() + test4[1].b(), 50);
+
+  auto abilities = flatbuffers::make_span(*monster->testarrayofsortedstruct());
+  TEST_EQ(abilities.size(), 4);
+  TEST_EQ(abilities[3].distance(), 40);
+
+  // Absent fields give empty views.
+  TEST_EQ(monster->vector_of_longs_span().empty(), true);
+  TEST_EQ(monster->testarrayofbools_span().empty(), true);
+  flatbuffers::FlatBufferBuilder builder;
+  builder.Finish(CreateStat(builder));
+  auto stat = flatbuffers::GetRoot<Stat>(builder.GetBufferPointer());
+  TEST_EQ(stat->id_view().empty(), true);
+}
+
 // example of parsing text straight into a buffer, and generating
 // text back from it:
 void ParseAndGenerateTextTest() {
@@ -633,6 +1972,77 @@ void ReflectionTest(uint8_t *flatbuf, size_t length) {
   // Verify the buffer first using reflection based verification
   TEST_EQ(flatbuffers::Verify(schema, *schema.root_table(), flatbuf, length),
           true);
+  TEST_EQ(flatbuffers::Verify(schema, *schema.root_table(), flatbuf, length,
+                              true), true);
+  flatbuffers::CompiledVerifier compiled(schema, *schema.root_table());
+  TEST_EQ(compiled.Verify(flatbuf, length), true);
+  TEST_EQ(compiled.Verify(flatbuf, length, true), true);
+  // A union type out of range is rejected.
+  std::vector<uint8_t> bad_union(flatbuf, flatbuf + length);
+  auto bad_table = reinterpret_cast<flatbuffers::Table *>(
+    GetMutableMonster(bad_union.data()));
+  TEST_EQ(bad_table->SetField<uint8_t>(Monster::VT_TEST_TYPE, 200, 0), true);
+  TEST_EQ(compiled.Verify(bad_union.data(), bad_union.size()), false);
+  TEST_EQ(compiled.Verify(bad_union.data(), bad_union.size(), true), false);
+  // A schema without any fields.
+  flatbuffers::Parser empty_parser;
+  TEST_EQ(empty_parser.Parse("table E {} root_type E;"), true);
+  empty_parser.Serialize();
+  auto &empty_schema =
+    *reflection::GetSchema(empty_parser.builder_.GetBufferPointer());
+  flatbuffers::CompiledVerifier empty_compiled(empty_schema,
+                                               *empty_schema.root_table());
+  flatbuffers::FlatBufferBuilder empty_builder;
+  empty_builder.Finish(flatbuffers::Offset<flatbuffers::Table>(
+    empty_builder.EndTable(empty_builder.StartTable())));
+  TEST_EQ(empty_compiled.Verify(empty_builder.GetBufferPointer(),
+                                empty_builder.GetSize()), true);
+
+  // A compiled schema reads the same values, without looking up fields.
+  flatbuffers::CompiledSchema dense(schema);
+  auto monster = dense.GetObjectId("MyGame.Example.Monster");
+  TEST_EQ(monster, dense.root_object());
+  TEST_EQ(dense.GetObjectId("Monster"), flatbuffers::CompiledSchema::kNotFound);
+  auto hp_id = dense.GetFieldId(monster, "hp");
+  TEST_EQ_STR(dense.GetFieldName(hp_id).c_str(), "hp");
+  TEST_EQ(dense.GetFieldId(monster, "hq"),
+          flatbuffers::CompiledSchema::kNotFound);
+  TEST_EQ(dense.GetScalar<int16_t>(root, hp_id), 80);
+  TEST_EQ(dense.GetInt(root, hp_id), 80);
+  TEST_EQ(dense.GetFloat(root, dense.GetFieldId(monster, "mana")), 150.0);
+  TEST_EQ_STR(dense.GetString(root, dense.GetFieldId(monster, "name"))
+                ->c_str(), "MyMonster");
+  auto pos_id = dense.GetFieldId(monster, "pos");
+  auto z_id = dense.GetFieldId(dense.GetField(pos_id).object, "z");
+  TEST_EQ(dense.GetFloat(*dense.GetStruct(root, pos_id), z_id), 3.0);
+  TEST_EQ(dense.GetVector(root, dense.GetFieldId(monster, "inventory"))
+            ->size(), 10U);
+  for (uint32_t i = 0; i < dense.num_objects(); i++) {
+    auto object_fields = schema.objects()->Get(i)->fields();
+    for (auto it = object_fields->begin(); it != object_fields->end(); ++it) {
+      auto id = dense.GetFieldId(i, it->name()->c_str());
+      TEST_EQ(dense.GetField(id).offset, it->offset());
+    }
+  }
+  auto &monster_object = dense.GetObject(monster);
+  std::vector<int64_t> ints(monster_object.scalars_end - monster_object.begin);
+  std::vector<double> doubles(ints.size());
+  dense.GetScalars(root, monster, ints.data());
+  dense.GetScalars(root, monster, doubles.data());
+  for (size_t i = 0; i < ints.size(); i++) {
+    auto &field = *fields->LookupByKey(
+      dense.GetFieldName(monster_object.begin + static_cast<uint32_t>(i))
+        .c_str());
+    if (root.CheckField(field.offset())) {
+      TEST_EQ(ints[i], flatbuffers::GetAnyFieldI(root, field));
+      TEST_EQ(doubles[i], flatbuffers::GetAnyFieldF(root, field));
+    } else if (flatbuffers::IsFloat(field.type()->base_type())) {
+      TEST_EQ(doubles[i], field.default_real());
+    } else {
+      TEST_EQ(ints[i], field.default_integer());
+      TEST_EQ(doubles[i], static_cast<double>(field.default_integer()));
+    }
+  }
 
   auto hp = flatbuffers::GetFieldI<uint16_t>(root, hp_field);
   TEST_EQ(hp, 80);
@@ -1158,6 +2568,12 @@ void ErrorTest() {
   TestError("table X { Y:[int]; YLength:int; }", "clash");
   TestError("table X { Y:string = 1; }", "scalar");
   TestError("table X { Y:byte; } root_type X; { Y:1, Y:2 }", "more than once");
+  TestError("table X { Y:[int] (eytzinger); }", "eytzinger");
+  TestError("table X { Y:[Z] (eytzinger); } table Z { A:int; }", "key");
+  TestError("table X { Y:[int] (hash_index: \"Z\"); }", "vector of uint");
+  TestError("table X { Y:[uint] (hash_index: \"Z\"); }", "must name");
+  TestError("table X { I:[uint] (hash_index: \"Y\"); Y:[Z] (eytzinger); } "
+            "table Z { A:int (key); }", "eytzinger order");
 }
 
 template<typename T> T TestValue(const char *json, const char *type_name) {
@@ -1819,7 +3235,32 @@ int main(int /*argc*/, const char * /*argv*/[]) {
 
   MiniReflectFlatBuffersTest(flatbuf.data());
 
+  TableViewTest(flatbuf.data());
+  SpanTest(flatbuf.data());
+  LazyVerifierTest(flatbuf.data(), flatbuf.size());
+  VerifierStatsTest(flatbuf.data(), flatbuf.size());
+  VectorOfStringsVerifierTest();
+
   SizePrefixedTest();
+  VtableDedupTest();
+  SharedStringTest();
+  SegmentedBuilderTest();
+  BuilderPoolTest();
+  BuilderPoolThreadsTest();
+  ArenaAllocatorTest();
+  FixedBufferTest();
+  SpliceTest();
+  DenseCreateTest();
+  SharedObjectsTest();
+  VerifierMemoizeTest();
+  ParallelVerifierTest();
+  IncrementalVerifierTest(false);
+  IncrementalVerifierTest(true);
+  BuilderStatsTest();
+  EytzingerTest();
+  KeyHashIndexTest();
+  GatherTest();
+  PrefetchingIteratorTest();
 
   #ifndef FLATBUFFERS_NO_FILE_TESTS
     #ifdef FLATBUFFERS_TEST_PATH_PREFIX